@@ -0,0 +1,678 @@
+#include "test_libft.h"
+
+// Benchmark engine defaults, overridable with BENCH_WARMUP / BENCH_ITERATIONS
+#define BENCH_DEFAULT_WARMUP 10
+#define BENCH_DEFAULT_ITERATIONS 101
+#define BENCH_MIN_SAMPLE_NS 2000.0
+#define BENCH_MAX_BATCH ((size_t)1 << 20)
+
+volatile uintptr_t bench_sink;
+
+// Helper function to read a monotonic, NTP-independent clock in nanoseconds
+static uint64_t bench_now_ns(void) {
+    struct timespec ts;
+#ifdef CLOCK_MONOTONIC_RAW
+    if (clock_gettime(CLOCK_MONOTONIC_RAW, &ts) == 0)
+        return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Helper function to read a positive size_t from the environment
+size_t bench_env_size(const char *name, size_t fallback) {
+    const char *value = getenv(name);
+    char *end;
+    unsigned long long parsed;
+
+    if (!value || !*value)
+        return fallback;
+    parsed = strtoull(value, &end, 10);
+    if (*end != '\0' || parsed == 0)
+        return fallback;
+    return (size_t)parsed;
+}
+
+// Helper function to build the benchmark configuration
+t_bench_config bench_default_config(void) {
+    t_bench_config config;
+
+    config.warmup = bench_env_size("BENCH_WARMUP", BENCH_DEFAULT_WARMUP);
+    config.iterations = bench_env_size("BENCH_ITERATIONS", BENCH_DEFAULT_ITERATIONS);
+    return config;
+}
+
+// Helper function to measure execution time of one batch of calls in nanoseconds
+double measure_time_ns(void (*test_func)(void), size_t batch) {
+    uint64_t start = bench_now_ns();
+    for (size_t i = 0; i < batch; i++) {
+        test_func();
+    }
+    return (double)(bench_now_ns() - start);
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Helper function to compute min/median/mean/p99/stddev over per-call samples
+void bench_compute_stats(double *samples, size_t count, t_bench_stats *stats) {
+    double sum = 0.0;
+    double variance = 0.0;
+    size_t rank;
+
+    qsort(samples, count, sizeof(*samples), compare_double);
+    for (size_t i = 0; i < count; i++) {
+        sum += samples[i];
+    }
+    stats->samples = count;
+    stats->min_ns = samples[0];
+    stats->mean_ns = sum / count;
+    if (count % 2)
+        stats->median_ns = samples[count / 2];
+    else
+        stats->median_ns = (samples[count / 2 - 1] + samples[count / 2]) / 2.0;
+    // Nearest-rank percentile
+    rank = (size_t)ceil(0.99 * count);
+    stats->p99_ns = samples[rank ? rank - 1 : 0];
+    for (size_t i = 0; i < count; i++) {
+        variance += (samples[i] - stats->mean_ns) * (samples[i] - stats->mean_ns);
+    }
+    stats->stddev_ns = count > 1 ? sqrt(variance / (count - 1)) : 0.0;
+}
+
+// Hardware performance counters around the timed part of a benchmark
+// (Linux perf_event_open). Events the kernel or CPU refuses are reported as
+// n/a; if none can be opened the benchmarks run with wall time only.
+// BENCH_COUNTERS=0 disables them
+static int bench_counter_fds[COUNTER_COUNT] = {-1, -1, -1, -1, -1};
+int bench_counters_state;    // 0 = not tried, 1 = open, -1 = unavailable
+static int bench_counters_wanted;
+static t_bench_counters bench_last_counters;
+
+#ifdef __linux__
+static int bench_counter_open(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+#endif
+
+// Helper function to open all counters once; returns 0 if any is usable
+int bench_counters_open(void) {
+    const char *env = getenv("BENCH_COUNTERS");
+
+    if (bench_counters_state != 0)
+        return bench_counters_state > 0 ? 0 : -1;
+    bench_counters_state = -1;
+    if (env && strcmp(env, "0") == 0)
+        return -1;
+#ifdef __linux__
+    bench_counter_fds[COUNTER_CYCLES] = bench_counter_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    bench_counter_fds[COUNTER_INSTRUCTIONS] = bench_counter_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    bench_counter_fds[COUNTER_L1D_MISSES] = bench_counter_open(PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    bench_counter_fds[COUNTER_LLC_MISSES] = bench_counter_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    bench_counter_fds[COUNTER_BRANCH_MISSES] = bench_counter_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        if (bench_counter_fds[i] >= 0)
+            bench_counters_state = 1;
+    }
+    if (bench_counters_state < 0)
+        printf("  \033[0;33mHardware counters unavailable (%s); reporting wall time only\033[0m\n",
+               strerror(errno));
+#endif
+    return bench_counters_state > 0 ? 0 : -1;
+}
+
+static void bench_counters_start(void) {
+#ifdef __linux__
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        if (bench_counter_fds[i] >= 0) {
+            ioctl(bench_counter_fds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(bench_counter_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+// Stop counting and store per-call values, scaled for multiplexing
+static void bench_counters_stop(size_t calls, t_bench_counters *out) {
+    memset(out, 0, sizeof(*out));
+#ifdef __linux__
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        uint64_t values[3];
+
+        if (bench_counter_fds[i] < 0)
+            continue;
+        ioctl(bench_counter_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        if (read(bench_counter_fds[i], values, sizeof(values)) != (ssize_t)sizeof(values) || values[2] == 0)
+            continue;
+        out->per_call[i] = (double)values[0] * ((double)values[1] / values[2]) / calls;
+        out->have[i] = 1;
+        out->valid = 1;
+    }
+#else
+    (void)calls;
+#endif
+}
+
+void bench_counters_close(void) {
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        if (bench_counter_fds[i] >= 0)
+            close(bench_counter_fds[i]);
+        bench_counter_fds[i] = -1;
+    }
+    bench_counters_state = 0;
+}
+
+// Per-call samples of the most recent run_benchmark(), sorted ascending.
+// Reused across runs; released by bench_release()
+static double *bench_samples;
+static size_t bench_samples_cap;
+
+// Run warmup, calibrate the batch size so each sample is well above clock
+// resolution, then collect config->iterations per-call timings
+int run_benchmark(void (*test_func)(void), const t_bench_config *config, t_bench_stats *stats) {
+    size_t batch = 1;
+
+    for (size_t i = 0; i < config->warmup; i++) {
+        test_func();
+    }
+    while (batch < BENCH_MAX_BATCH && measure_time_ns(test_func, batch) < BENCH_MIN_SAMPLE_NS) {
+        batch *= 2;
+    }
+    if (config->iterations > bench_samples_cap) {
+        double *grown = realloc(bench_samples, config->iterations * sizeof(*grown));
+        if (!grown)
+            return -1;
+        bench_samples = grown;
+        bench_samples_cap = config->iterations;
+    }
+    if (bench_counters_wanted && bench_counters_open() == 0)
+        bench_counters_start();
+    for (size_t i = 0; i < config->iterations; i++) {
+        bench_samples[i] = measure_time_ns(test_func, batch) / batch;
+    }
+    if (bench_counters_wanted && bench_counters_state > 0)
+        bench_counters_stop(config->iterations * batch, &bench_last_counters);
+    else
+        bench_last_counters.valid = 0;
+    bench_compute_stats(bench_samples, config->iterations, stats);
+    stats->batch = batch;
+    return 0;
+}
+
+// Run a benchmark with the hardware counters around its timed samples;
+// counters->valid is 0 when none could be read
+int run_benchmark_counted(void (*test_func)(void), const t_bench_config *config,
+                          t_bench_stats *stats, t_bench_counters *counters) {
+    int status;
+
+    bench_counters_wanted = 1;
+    status = run_benchmark(test_func, config, stats);
+    bench_counters_wanted = 0;
+    *counters = bench_last_counters;
+    if (status != 0)
+        counters->valid = 0;
+    return status;
+}
+
+void bench_release(void) {
+    free(bench_samples);
+    bench_samples = NULL;
+    bench_samples_cap = 0;
+    bench_counters_close();
+}
+
+// Performance baselines. With BENCH_BASELINE=<file>, BENCH_BASELINE_MODE=record
+// stores every observed benchmark as JSON keyed by name and input size, and
+// BENCH_BASELINE_MODE=append adds another process run to it (make
+// perf-baseline records PERF_RUNS of them). BENCH_BASELINE_MODE=check counts
+// entries whose median is more than PERF_THRESHOLD percent (default 10)
+// above the slowest recorded run's median and whose samples are
+// significantly slower than the baseline scaled by that threshold (one-sided
+// Mann-Whitney U test at PERF_ALPHA). The U test treats samples of one run
+// as independent, which run-to-run variance (clock speed, neighbours,
+// layout) breaks; the run-level comparison is what keeps the gate stable.
+// A kernel that still looks regressed is measured again up to
+// PERF_RECHECKS times (default 3) and its fastest run is kept
+#define PERF_MAX_ENTRIES 256
+#define PERF_MAX_RUNS 16
+#define PERF_NAME_MAX 32
+#define PERF_DEFAULT_THRESHOLD 10
+#define PERF_DEFAULT_RECHECKS 3
+#define PERF_ALPHA 0.01
+
+typedef struct s_perf_entry {
+    char name[PERF_NAME_MAX];
+    size_t size;            // input bytes, or element count for table kernels
+    size_t count;
+    double *samples_ns;     // sorted per-call timings, all runs pooled
+    double run_medians_ns[PERF_MAX_RUNS];
+    size_t runs;
+    int rechecks;           // extra runs measured before keeping these samples
+} t_perf_entry;
+
+typedef struct s_perf_store {
+    t_perf_entry entries[PERF_MAX_ENTRIES];
+    size_t count;
+} t_perf_store;
+
+static t_perf_store perf_baseline;
+static t_perf_store perf_current;
+const char *perf_path;
+int perf_checking;
+static int perf_appending;
+
+// Helper function to compute the median of a sorted sample array
+static double perf_median(const double *sorted, size_t n) {
+    return n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2.0;
+}
+
+static t_perf_entry *perf_find(t_perf_store *store, const char *name, size_t size) {
+    for (size_t i = 0; i < store->count; i++) {
+        if (store->entries[i].size == size && strcmp(store->entries[i].name, name) == 0)
+            return &store->entries[i];
+    }
+    return NULL;
+}
+
+static t_perf_entry *perf_add(t_perf_store *store, const char *name, size_t size,
+                              const double *samples, size_t count) {
+    t_perf_entry *entry;
+
+    if (store->count == PERF_MAX_ENTRIES)
+        return NULL;
+    entry = &store->entries[store->count];
+    entry->samples_ns = malloc(count * sizeof(*samples));
+    if (!entry->samples_ns)
+        return NULL;
+    if (samples)
+        memcpy(entry->samples_ns, samples, count * sizeof(*samples));
+    snprintf(entry->name, sizeof(entry->name), "%s", name);
+    entry->size = size;
+    entry->count = count;
+    entry->runs = 0;
+    if (samples && count)
+        entry->run_medians_ns[entry->runs++] = perf_median(samples, count);
+    entry->rechecks = 0;
+    store->count++;
+    return entry;
+}
+
+// Helper function to fold the samples of a new run into a baseline entry
+static int perf_merge(t_perf_entry *base, const t_perf_entry *run) {
+    double *pooled = realloc(base->samples_ns, (base->count + run->count) * sizeof(*pooled));
+
+    if (!pooled)
+        return -1;
+    memcpy(pooled + base->count, run->samples_ns, run->count * sizeof(*pooled));
+    base->samples_ns = pooled;
+    base->count += run->count;
+    qsort(base->samples_ns, base->count, sizeof(*base->samples_ns), compare_double);
+    if (base->runs < PERF_MAX_RUNS)
+        base->run_medians_ns[base->runs++] = perf_median(run->samples_ns, run->count);
+    return 0;
+}
+
+// Helper function to return the median of the slowest recorded run
+static double perf_slowest_run(const t_perf_entry *entry) {
+    double slowest = 0.0;
+
+    for (size_t i = 0; i < entry->runs; i++) {
+        if (entry->run_medians_ns[i] > slowest)
+            slowest = entry->run_medians_ns[i];
+    }
+    return slowest;
+}
+
+static void perf_store_free(t_perf_store *store) {
+    for (size_t i = 0; i < store->count; i++) {
+        free(store->entries[i].samples_ns);
+    }
+    store->count = 0;
+}
+
+// Minimal reader for the format written by perf_write_baseline()
+static int perf_load_baseline(const char *path, t_perf_store *store) {
+    FILE *fp = fopen(path, "r");
+    char *buf;
+    char *p;
+    long len;
+    double *samples = NULL;
+    size_t capacity = 0;
+
+    if (!fp)
+        return -1;
+    fseek(fp, 0, SEEK_END);
+    len = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    buf = malloc((size_t)len + 1);
+    if (!buf || fread(buf, 1, (size_t)len, fp) != (size_t)len) {
+        free(buf);
+        fclose(fp);
+        return -1;
+    }
+    buf[len] = '\0';
+    fclose(fp);
+
+    p = buf;
+    while ((p = strstr(p, "\"name\"")) != NULL) {
+        char name[PERF_NAME_MAX];
+        size_t name_len = 0;
+        size_t size;
+        size_t count = 0;
+        char *end;
+
+        p = strchr(p + 6, '"');
+        if (!p)
+            break;
+        p++;
+        while (*p && *p != '"' && name_len + 1 < sizeof(name))
+            name[name_len++] = *p++;
+        name[name_len] = '\0';
+        if (!(p = strstr(p, "\"size\"")) || !(p = strchr(p, ':')))
+            break;
+        size = (size_t)strtoull(p + 1, &end, 10);
+        if (!(p = strstr(end, "\"samples_ns\"")) || !(p = strchr(p, '[')))
+            break;
+        p++;
+        for (;;) {
+            double value = strtod(p, &end);
+            if (end == p)
+                break;
+            // Grow rather than truncate: the file is sorted, so dropping the
+            // tail would keep only the fastest samples
+            if (count == capacity) {
+                size_t grown = capacity ? capacity * 2 : 1024;
+                double *larger = realloc(samples, grown * sizeof(*samples));
+
+                if (!larger) {
+                    free(samples);
+                    free(buf);
+                    return -1;
+                }
+                samples = larger;
+                capacity = grown;
+            }
+            samples[count++] = value;
+            p = end;
+            while (*p == ',' || *p == ' ' || *p == '\n')
+                p++;
+        }
+        if (count > 0) {
+            t_perf_entry *entry;
+            char *object_end = strchr(p, '}');
+            char *medians = strstr(p, "\"run_medians_ns\"");
+
+            qsort(samples, count, sizeof(*samples), compare_double);
+            entry = perf_add(store, name, size, samples, count);
+            // Baselines without per-run medians count as a single run
+            if (entry && medians && object_end && medians < object_end && (p = strchr(medians, '['))) {
+                entry->runs = 0;
+                p++;
+                while (entry->runs < PERF_MAX_RUNS) {
+                    double value = strtod(p, &end);
+                    if (end == p)
+                        break;
+                    entry->run_medians_ns[entry->runs++] = value;
+                    p = end;
+                    while (*p == ',' || *p == ' ')
+                        p++;
+                }
+            }
+        }
+    }
+    free(samples);
+    free(buf);
+    return 0;
+}
+
+static int perf_write_baseline(const char *path, const t_perf_store *store) {
+    FILE *fp = fopen(path, "w");
+
+    if (!fp)
+        return -1;
+    fprintf(fp, "{\n  \"version\": 2,\n  \"results\": [\n");
+    for (size_t i = 0; i < store->count; i++) {
+        const t_perf_entry *entry = &store->entries[i];
+
+        fprintf(fp, "    {\"name\": \"%s\", \"size\": %zu, \"samples_ns\": [", entry->name, entry->size);
+        for (size_t j = 0; j < entry->count; j++) {
+            fprintf(fp, "%s%.3f", j ? ", " : "", entry->samples_ns[j]);
+        }
+        fprintf(fp, "], \"run_medians_ns\": [");
+        for (size_t j = 0; j < entry->runs; j++) {
+            fprintf(fp, "%s%.3f", j ? ", " : "", entry->run_medians_ns[j]);
+        }
+        fprintf(fp, "]}%s\n", i + 1 < store->count ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+    return fclose(fp);
+}
+
+// One-sided Mann-Whitney U test (normal approximation, tie-averaged ranks):
+// p-value for "current samples tend to be larger than baseline samples
+// scaled by shift". Testing against the shifted baseline asks whether the
+// slowdown exceeds the threshold, not merely whether there is one
+static double perf_mann_whitney_p(const double *base, size_t n1, double shift, const double *cur, size_t n2) {
+    size_t i = 0;
+    size_t j = 0;
+    double rank_sum_cur = 0.0;
+    double rank = 1.0;
+    double n = (double)(n1 + n2);
+    double u;
+    double mean;
+    double sd;
+
+    // Both inputs are sorted, so merge them and assign average ranks to ties
+    while (i < n1 || j < n2) {
+        double value = (j >= n2 || (i < n1 && base[i] * shift <= cur[j])) ? base[i] * shift : cur[j];
+        size_t ties_base = 0;
+        size_t ties_cur = 0;
+        double avg;
+
+        while (i < n1 && base[i] * shift == value) {
+            ties_base++;
+            i++;
+        }
+        while (j < n2 && cur[j] == value) {
+            ties_cur++;
+            j++;
+        }
+        avg = rank + (ties_base + ties_cur - 1) / 2.0;
+        rank_sum_cur += avg * ties_cur;
+        rank += ties_base + ties_cur;
+    }
+    u = rank_sum_cur - n2 * (n2 + 1) / 2.0;
+    mean = n1 * n2 / 2.0;
+    sd = sqrt(n1 * n2 * (n + 1) / 12.0);
+    if (sd == 0.0)
+        return 1.0;
+    return 0.5 * erfc(((u - mean) / sd) / sqrt(2.0));
+}
+
+// Enable baseline recording/checking from the environment
+void perf_init(void) {
+    const char *mode = getenv("BENCH_BASELINE_MODE");
+
+    perf_path = getenv("BENCH_BASELINE");
+    if (!perf_path || !*perf_path) {
+        perf_path = NULL;
+        return;
+    }
+    perf_checking = mode && strcmp(mode, "check") == 0;
+    perf_appending = mode && strcmp(mode, "append") == 0;
+    if ((perf_checking || perf_appending) && perf_load_baseline(perf_path, &perf_baseline) != 0) {
+        printf("\033[1;31mCannot read baseline %s; recording a new one instead\033[0m\n", perf_path);
+        perf_checking = 0;
+        perf_appending = 0;
+    }
+}
+
+// Helper function to compare samples against their baseline: stores the
+// median shift over the slowest recorded run in percent and the p-value,
+// returns 1 for a regression
+static int perf_regressed(const t_perf_entry *base, const t_perf_entry *cur, int threshold,
+                          double *delta, double *p) {
+    *delta = (perf_median(cur->samples_ns, cur->count) / perf_slowest_run(base) - 1.0) * 100.0;
+    *p = perf_mann_whitney_p(base->samples_ns, base->count, 1.0 + threshold / 100.0,
+                             cur->samples_ns, cur->count);
+    return *delta > threshold && *p < PERF_ALPHA;
+}
+
+// Record the samples of the most recent run_benchmark() of kernel under
+// name/size. While checking, a result that looks regressed is re-measured
+// here, where the kernel's inputs are still prepared, keeping the fastest run
+void perf_observe(const char *name, size_t size, const t_bench_stats *stats,
+                  void (*kernel)(void), const t_bench_config *config) {
+    int threshold = (int)bench_env_size("PERF_THRESHOLD", PERF_DEFAULT_THRESHOLD);
+    int rechecks = (int)bench_env_size("PERF_RECHECKS", PERF_DEFAULT_RECHECKS);
+    const t_perf_entry *base;
+    t_perf_entry *entry;
+    t_bench_stats again;
+    double delta;
+    double p;
+
+    if (!perf_path || perf_find(&perf_current, name, size))
+        return;
+    entry = perf_add(&perf_current, name, size, bench_samples, stats->samples);
+    base = perf_checking ? perf_find(&perf_baseline, name, size) : NULL;
+    if (!entry || !base)
+        return;
+    while (entry->rechecks < rechecks && perf_regressed(base, entry, threshold, &delta, &p)) {
+        entry->rechecks++;
+        if (run_benchmark(kernel, config, &again) != 0 || again.samples != entry->count)
+            break;
+        if (perf_median(bench_samples, again.samples) < perf_median(entry->samples_ns, entry->count))
+            memcpy(entry->samples_ns, bench_samples, again.samples * sizeof(*bench_samples));
+    }
+}
+
+// Write or check the baseline; returns the number of regressions
+int perf_finish(void) {
+    int threshold = (int)bench_env_size("PERF_THRESHOLD", PERF_DEFAULT_THRESHOLD);
+    int regressions = 0;
+
+    if (!perf_path)
+        return 0;
+    if (perf_appending) {
+        for (size_t i = 0; i < perf_current.count; i++) {
+            const t_perf_entry *cur = &perf_current.entries[i];
+            t_perf_entry *base = perf_find(&perf_baseline, cur->name, cur->size);
+
+            if (base)
+                perf_merge(base, cur);
+            else
+                perf_add(&perf_baseline, cur->name, cur->size, cur->samples_ns, cur->count);
+        }
+        if (perf_write_baseline(perf_path, &perf_baseline) != 0)
+            printf("\033[1;31mFailed to write baseline %s\033[0m\n", perf_path);
+        else
+            printf("  Added this run to %zu benchmark baselines in %s\n", perf_baseline.count, perf_path);
+        perf_store_free(&perf_current);
+        perf_store_free(&perf_baseline);
+        return 0;
+    }
+    if (!perf_checking) {
+        if (perf_write_baseline(perf_path, &perf_current) != 0)
+            printf("\033[1;31mFailed to write baseline %s\033[0m\n", perf_path);
+        else
+            printf("  Recorded %zu benchmark baselines in %s\n", perf_current.count, perf_path);
+        perf_store_free(&perf_current);
+        return 0;
+    }
+    printf("  \033[1m%-14s %8s %12s %12s %8s %9s\033[0m   (base: median of the slowest recorded run)\n",
+           "benchmark", "size", "base (ns)", "now (ns)", "delta", "p-value");
+    for (size_t i = 0; i < perf_current.count; i++) {
+        const t_perf_entry *cur = &perf_current.entries[i];
+        const t_perf_entry *base = perf_find(&perf_baseline, cur->name, cur->size);
+        double base_median;
+        double cur_median;
+        double delta;
+        double p;
+        int regressed;
+
+        if (!base) {
+            printf("  %-14s %8zu %12s %12.1f %8s %9s  new\n", cur->name, cur->size, "-",
+                   perf_median(cur->samples_ns, cur->count), "-", "-");
+            continue;
+        }
+        base_median = perf_slowest_run(base);
+        cur_median = perf_median(cur->samples_ns, cur->count);
+        regressed = perf_regressed(base, cur, threshold, &delta, &p);
+        regressions += regressed;
+        printf("  %s%-14s %8zu %12.1f %12.1f %+7.1f%% %9.2g  %s",
+               regressed ? "\033[1;31m" : "", cur->name, cur->size,
+               base_median, cur_median, delta, p, regressed ? "REGRESSED" : "ok");
+        if (cur->rechecks)
+            printf(" (best of %d runs)", cur->rechecks + 1);
+        printf("\033[0m\n");
+    }
+    printf("  %d regression(s) beyond %d%% at p < %.2f\n", regressions, threshold, PERF_ALPHA);
+    perf_store_free(&perf_current);
+    perf_store_free(&perf_baseline);
+    return regressions;
+}
+
+// Helper function to print performance result
+void print_performance_result(const char *test_name, const t_bench_stats *stats) {
+    printf("  \033[1;36m%-10s median %10.1f ns  min %10.1f  mean %10.1f  p99 %10.1f  sd %8.1f  (%zu x %zu)\033[0m\n",
+           test_name, stats->median_ns, stats->min_ns, stats->mean_ns,
+           stats->p99_ns, stats->stddev_ns, stats->samples, stats->batch);
+}
+
+// Helper function to print per-call hardware counters under a result
+void print_counter_result(const t_bench_counters *counters) {
+    static const char *labels[COUNTER_COUNT] = {"cycles", "instr", "L1D-miss", "LLC-miss", "br-miss"};
+
+    if (!counters->valid)
+        return;
+    printf("  %-10s", "");
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        if (counters->have[i])
+            printf(" %s %.2f", labels[i], counters->per_call[i]);
+        else
+            printf(" %s n/a", labels[i]);
+        if (i == COUNTER_INSTRUCTIONS && counters->have[COUNTER_CYCLES]
+            && counters->have[COUNTER_INSTRUCTIONS] && counters->per_call[COUNTER_CYCLES] > 0)
+            printf(" IPC %.2f", counters->per_call[COUNTER_INSTRUCTIONS] / counters->per_call[COUNTER_CYCLES]);
+    }
+    printf("  (per call)\n");
+}
+
+// Add performance test wrapper with error checking
+void run_performance_test(const char *test_name, size_t input_size, void (*test_func)(void)) {
+    t_bench_config config = bench_default_config();
+    t_bench_stats stats;
+    t_bench_counters counters;
+    t_alloc_profile profile;
+
+    if (run_benchmark_counted(test_func, &config, &stats, &counters) != 0) {
+        printf("  \033[1;31m%s: benchmark allocation failed\033[0m\n", test_name);
+        return;
+    }
+    perf_observe(test_name, input_size, &stats, test_func, &config);
+    print_performance_result(test_name, &stats);
+    print_counter_result(&counters);
+
+    // One extra traced call gives the per-call allocation profile
+    alloc_trace_begin();
+    test_func();
+    alloc_trace_end(&profile);
+    if (profile.allocations) {
+        printf("  %-10s ", "");
+        print_alloc_profile(&profile);
+    }
+}
@@ -0,0 +1,199 @@
+#include "test_libft.h"
+
+// Worst-case inputs for ft_strnstr. Enabled with BENCH_ADVERSARIAL=1.
+// The haystack is n-1 'a's and a 'b', the needle m-1 'a's and a 'b', so a
+// naive search matches m-1 characters at every one of the n-m+1 offsets
+// before failing. Times are fitted to t = k * n^b * m^c over the grid: a
+// linear-time search has c near 0, a naive one c near 1 (O(n*m)). Like a
+// complexity mismatch, an O(n*m) fit that explains at least ADV_MIN_R2 of the
+// variance fails the run; a poorer fit is only reported.
+// BENCH_ADVERSARIAL_MAX caps the largest haystack (default 64 KiB)
+#define ADV_DEFAULT_MAX ((size_t)64 << 10)
+#define ADV_MIN_HAYSTACK ((size_t)1 << 10)
+#define ADV_MIN_NEEDLE 4
+#define ADV_CELL_BUDGET_NS 50000000.0
+#define ADV_CELL_LIMIT_NS 1000000000.0
+#define ADV_MIN_ITERATIONS 3
+#define ADV_QUADRATIC_EXPONENT 0.5  // needle exponent above this is flagged
+#define ADV_MIN_R2 0.9              // fit quality needed to count the flag
+#define ADV_MAX_CELLS 64
+
+static char *adv_haystack;
+static char *adv_needle;
+static size_t adv_len;
+
+static void bench_strnstr_adversarial(void) {
+    BENCH_ESCAPE(adv_haystack);
+    BENCH_ESCAPE(adv_needle);
+    BENCH_KEEP(ft_strnstr(adv_haystack, adv_needle, adv_len));
+}
+
+// Helper function to build the haystack and needle for one grid cell
+static void adv_fill(size_t n, size_t m) {
+    memset(adv_haystack, 'a', n - 1);
+    adv_haystack[n - 1] = 'b';
+    adv_haystack[n] = '\0';
+    memset(adv_needle, 'a', m - 1);
+    adv_needle[m - 1] = 'b';
+    adv_needle[m] = '\0';
+    adv_len = n;
+}
+
+// Helper function to solve the 3x3 system a * x = b by Cramer's rule
+static int adv_solve3(double a[3][3], const double b[3], double x[3]) {
+    double det = a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1])
+               - a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0])
+               + a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+
+    if (fabs(det) < 1e-12)
+        return -1;
+    for (int col = 0; col < 3; col++) {
+        double m[3][3];
+
+        memcpy(m, a, sizeof(m));
+        for (int row = 0; row < 3; row++)
+            m[row][col] = b[row];
+        x[col] = (m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+                - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+                + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0])) / det;
+    }
+    return 0;
+}
+
+// Least-squares fit of log t = k + b log n + c log m; r2 is the share of
+// the variance in log t that the fit explains
+static int adv_fit(const double *n, const double *m, const double *t, size_t count,
+                   double *b, double *c, double *r2) {
+    double a[3][3] = {{0}};
+    double rhs[3] = {0};
+    double coef[3];
+    double mean = 0;
+    double ss_tot = 0;
+    double ss_res = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        double row[3] = {1.0, log(n[i]), log(m[i])};
+
+        for (int r = 0; r < 3; r++) {
+            for (int k = 0; k < 3; k++)
+                a[r][k] += row[r] * row[k];
+            rhs[r] += row[r] * log(t[i]);
+        }
+        mean += log(t[i]);
+    }
+    if (count < 4 || adv_solve3(a, rhs, coef) != 0)
+        return -1;
+    mean /= (double)count;
+    for (size_t i = 0; i < count; i++) {
+        double predicted = coef[0] + coef[1] * log(n[i]) + coef[2] * log(m[i]);
+
+        ss_tot += (log(t[i]) - mean) * (log(t[i]) - mean);
+        ss_res += (log(t[i]) - predicted) * (log(t[i]) - predicted);
+    }
+    *b = coef[1];
+    *c = coef[2];
+    *r2 = ss_tot > 0 ? 1.0 - ss_res / ss_tot : 1.0;
+    return 0;
+}
+
+// Helper function to time one cell, spending about ADV_CELL_BUDGET_NS on it.
+// Returns the median ns per call, or the single probe call when it alone is
+// over ADV_CELL_LIMIT_NS
+static double adv_time_cell(const t_bench_config *base, int *too_slow) {
+    t_bench_config config = *base;
+    t_bench_stats stats;
+    double probe = measure_time_ns(bench_strnstr_adversarial, 1);
+    size_t affordable = (size_t)(ADV_CELL_BUDGET_NS / (probe > 1.0 ? probe : 1.0));
+
+    *too_slow = probe > ADV_CELL_LIMIT_NS;
+    if (*too_slow)
+        return probe;
+    if (config.iterations > affordable)
+        config.iterations = affordable < ADV_MIN_ITERATIONS ? ADV_MIN_ITERATIONS : affordable;
+    if (config.warmup > affordable)
+        config.warmup = 1;
+    if (run_benchmark(bench_strnstr_adversarial, &config, &stats) != 0)
+        return probe;
+    return stats.median_ns;
+}
+
+int run_strnstr_adversarial(void) {
+    t_bench_config base = bench_default_config();
+    size_t max_size = bench_env_size("BENCH_ADVERSARIAL_MAX", ADV_DEFAULT_MAX);
+    double cell_n[ADV_MAX_CELLS];
+    double cell_m[ADV_MAX_CELLS];
+    double cell_t[ADV_MAX_CELLS];
+    size_t cells = 0;
+    int wrong = 0;
+    double b;
+    double c;
+    double r2;
+
+    if (max_size < ADV_MIN_HAYSTACK)
+        max_size = ADV_MIN_HAYSTACK;
+    adv_haystack = malloc(max_size + 1);
+    adv_needle = malloc(max_size + 1);
+    if (!adv_haystack || !adv_needle) {
+        printf("  \033[1;31mAdversarial strnstr skipped: allocation failed\033[0m\n");
+        free(adv_haystack);
+        free(adv_needle);
+        return 0;
+    }
+
+    printf("  \033[1m%10s", "n \\ m");
+    for (size_t m = ADV_MIN_NEEDLE; m < max_size; m *= 4)
+        printf(" %9zu", m);
+    printf("   (us per call, median)\033[0m\n");
+    for (size_t n = ADV_MIN_HAYSTACK; n <= max_size; n *= 4) {
+        int skip = 0;
+
+        printf("  %10zu", n);
+        for (size_t m = ADV_MIN_NEEDLE; m < max_size; m *= 4) {
+            int too_slow;
+            double ns;
+
+            if (m >= n || skip) {
+                printf(" %9s", m >= n ? "" : "skipped");
+                continue;
+            }
+            adv_fill(n, m);
+            if (ft_strnstr(adv_haystack, adv_needle, adv_len) != adv_haystack + n - m)
+                wrong++;
+            ns = adv_time_cell(&base, &too_slow);
+            // Longer needles in this row would only be slower
+            skip = too_slow;
+            printf(too_slow ? " %8.0f>" : " %9.2f", ns / 1000.0);
+            if (cells < ADV_MAX_CELLS) {
+                cell_n[cells] = (double)n;
+                cell_m[cells] = (double)m;
+                cell_t[cells] = ns;
+                cells++;
+            }
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+    free(adv_haystack);
+    free(adv_needle);
+    adv_haystack = NULL;
+    adv_needle = NULL;
+
+    if (wrong)
+        printf("  \033[1;31mft_strnstr missed the match at the end of the haystack in %d cells\033[0m\n", wrong);
+    if (adv_fit(cell_n, cell_m, cell_t, cells, &b, &c, &r2) != 0) {
+        printf("  Not enough cells to fit a growth rate; raise BENCH_ADVERSARIAL_MAX\n");
+        return wrong > 0;
+    }
+    printf("  Fit: time ~ n^%.2f * m^%.2f  (R^2 %.3f)\n", b, c, r2);
+    if (c > ADV_QUADRATIC_EXPONENT && r2 >= ADV_MIN_R2) {
+        printf("  \033[1;31mft_strnstr is O(n*m) on adversarial input: a 16x longer needle costs %.0fx more\033[0m\n",
+               pow(16.0, c));
+        return (wrong > 0) + 1;
+    }
+    if (c > ADV_QUADRATIC_EXPONENT)
+        printf("  \033[1;33mft_strnstr may be O(n*m), but the fit is too poor to count (R^2 under %.1f)\033[0m\n",
+               ADV_MIN_R2);
+    else
+        printf("  \033[1;32mft_strnstr time does not grow with needle length (linear search)\033[0m\n");
+    return wrong > 0;
+}
@@ -0,0 +1,461 @@
+#include "test_libft.h"
+
+// Complexity-class detection. Enabled with BENCH_COMPLEXITY=1. Every kernel
+// below runs at input sizes from CPLX_MIN_SIZE doubling up to
+// BENCH_COMPLEXITY_MAX (default 65536), and the medians are fitted to
+// t = a + b * f(n) for f in 1, log n, n, n log n and n^2. The fit is weighted
+// by 1 / t^2 so small sizes count as much as large ones. The class with the
+// smallest residual wins, but a costlier class has to beat a cheaper one by
+// CPLX_OCCAM. A class of higher degree than the function needs, such as an
+// ft_strlen in a loop condition turning ft_strlcat quadratic, is reported.
+// It only counts as a failure when the evidence is strong (see cplx_suspect)
+// and the same evidence shows up again in every one of
+// BENCH_COMPLEXITY_PASSES (default 3) measurements of that function
+#define CPLX_DEFAULT_MAX ((size_t)1 << 16)
+#define CPLX_MIN_SIZE ((size_t)16)
+#define CPLX_MAX_POINTS 32
+#define CPLX_CELL_BUDGET_NS 10000000.0
+#define CPLX_MIN_ITERATIONS 5
+#define CPLX_OCCAM 0.8
+#define CPLX_NEGLIGIBLE 0.05
+#define CPLX_GATE_CONFIDENCE 60.0
+#define CPLX_EXPONENT_MARGIN 0.4
+#define CPLX_DEFAULT_PASSES 3
+
+typedef enum e_cplx_class {
+    CPLX_O1,
+    CPLX_OLOGN,
+    CPLX_ON,
+    CPLX_ONLOGN,
+    CPLX_ON2,
+    CPLX_CLASS_COUNT
+} e_cplx_class;
+
+static const char *cplx_class_names[CPLX_CLASS_COUNT] = {
+    "O(1)", "O(log n)", "O(n)", "O(n log n)", "O(n^2)"
+};
+
+// Polynomial degree of each class. Cache misses make per-element cost creep
+// up as n outgrows each cache level, which fits as an extra log n factor, so
+// only a higher degree is reported as a regression
+static const int cplx_degree[CPLX_CLASS_COUNT] = {0, 0, 1, 1, 2};
+
+static char *cplx_src;          // n characters of words and spaces
+static char *cplx_padded;       // the same text with spaces around it
+static char *cplx_dst;          // room for 2n + 1 bytes
+static size_t cplx_n;
+static t_list *cplx_list;       // n nodes
+static t_list *cplx_tail;
+static t_list cplx_extra;
+
+static void cplx_noop(void *content) {
+    BENCH_KEEP(content);
+}
+
+static void cplx_strlen(void) {
+    BENCH_ESCAPE(cplx_src);
+    BENCH_KEEP(ft_strlen(cplx_src));
+}
+
+// Searches for a character that is never present, so the whole string is scanned
+static void cplx_strchr(void) {
+    BENCH_ESCAPE(cplx_src);
+    BENCH_KEEP(ft_strchr(cplx_src, '#'));
+}
+
+static void cplx_memset(void) {
+    BENCH_KEEP(ft_memset(cplx_dst, 'A', cplx_n));
+    BENCH_ESCAPE(cplx_dst);
+}
+
+static void cplx_memcpy(void) {
+    BENCH_KEEP(ft_memcpy(cplx_dst, cplx_src, cplx_n));
+    BENCH_ESCAPE(cplx_dst);
+}
+
+static void cplx_strlcpy(void) {
+    BENCH_KEEP(ft_strlcpy(cplx_dst, cplx_src, 2 * cplx_n + 1));
+    BENCH_ESCAPE(cplx_dst);
+}
+
+// Appends the second half of the text to a copy of the first half
+static void cplx_strlcat(void) {
+    memcpy(cplx_dst, cplx_src, cplx_n / 2);
+    cplx_dst[cplx_n / 2] = '\0';
+    BENCH_KEEP(ft_strlcat(cplx_dst, cplx_src + cplx_n / 2, cplx_n + 1));
+    BENCH_ESCAPE(cplx_dst);
+}
+
+static void cplx_strdup(void) {
+    char *copy = ft_strdup(cplx_src);
+    BENCH_ESCAPE(copy);
+    free(copy);
+}
+
+static void cplx_substr(void) {
+    char *sub = ft_substr(cplx_src, 0, cplx_n);
+    BENCH_ESCAPE(sub);
+    free(sub);
+}
+
+static void cplx_strjoin(void) {
+    char *joined = ft_strjoin(cplx_src, cplx_src);
+    BENCH_ESCAPE(joined);
+    free(joined);
+}
+
+static void cplx_strtrim(void) {
+    char *trimmed = ft_strtrim(cplx_padded, " ");
+    BENCH_ESCAPE(trimmed);
+    free(trimmed);
+}
+
+static void cplx_split(void) {
+    char **words = ft_split(cplx_src, ' ');
+
+    if (!words)
+        return;
+    for (size_t i = 0; words[i]; i++)
+        free(words[i]);
+    free(words);
+}
+
+static void cplx_lstadd_front(void) {
+    ft_lstadd_front(&cplx_list, &cplx_extra);
+    cplx_list = cplx_extra.next;
+    cplx_extra.next = NULL;
+}
+
+// Appends one node to the n-node list and unlinks it again
+static void cplx_lstadd_back(void) {
+    ft_lstadd_back(&cplx_list, &cplx_extra);
+    cplx_tail->next = NULL;
+}
+
+static void cplx_lstsize(void) {
+    BENCH_KEEP(ft_lstsize(cplx_list));
+}
+
+static void cplx_lstlast(void) {
+    BENCH_KEEP(ft_lstlast(cplx_list));
+}
+
+static void cplx_lstiter(void) {
+    ft_lstiter(cplx_list, cplx_noop);
+}
+
+typedef struct s_cplx_case {
+    const char *name;
+    void (*kernel)(void);
+    e_cplx_class expected;      // the class a sound implementation reaches
+} t_cplx_case;
+
+static const t_cplx_case cplx_cases[] = {
+    {"strlen", cplx_strlen, CPLX_ON},
+    {"strchr", cplx_strchr, CPLX_ON},
+    {"memset", cplx_memset, CPLX_ON},
+    {"memcpy", cplx_memcpy, CPLX_ON},
+    {"strlcpy", cplx_strlcpy, CPLX_ON},
+    {"strlcat", cplx_strlcat, CPLX_ON},
+    {"strdup", cplx_strdup, CPLX_ON},
+    {"substr", cplx_substr, CPLX_ON},
+    {"strjoin", cplx_strjoin, CPLX_ON},
+    {"strtrim", cplx_strtrim, CPLX_ON},
+    {"split", cplx_split, CPLX_ON},
+    {"lstadd_front", cplx_lstadd_front, CPLX_O1},
+    {"lstadd_back", cplx_lstadd_back, CPLX_ON},
+    {"lstsize", cplx_lstsize, CPLX_ON},
+    {"lstlast", cplx_lstlast, CPLX_ON},
+    {"lstiter", cplx_lstiter, CPLX_ON},
+};
+
+static void cplx_list_free(void) {
+    while (cplx_list) {
+        t_list *next = cplx_list->next;
+        free(cplx_list);
+        cplx_list = next;
+    }
+    cplx_tail = NULL;
+}
+
+// Helper function to build the inputs for size n: words of 1-8 letters
+// separated by single spaces, and an n-node list
+static int cplx_prepare(size_t n) {
+    uint32_t state = 0x2545F491u;
+    size_t word = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        state = state * 1664525u + 1013904223u;
+        if (word > 0 && (word >= 8 || (state >> 28) < 4) && i + 1 < n) {
+            cplx_src[i] = ' ';
+            word = 0;
+        } else {
+            cplx_src[i] = 'a' + (char)((state >> 24) % 26);
+            word++;
+        }
+    }
+    cplx_src[n] = '\0';
+    memset(cplx_padded, ' ', 4);
+    memcpy(cplx_padded + 4, cplx_src, n);
+    memset(cplx_padded + 4 + n, ' ', 4);
+    cplx_padded[n + 8] = '\0';
+    cplx_n = n;
+
+    cplx_list_free();
+    for (size_t i = 0; i < n; i++) {
+        t_list *node = ft_lstnew(cplx_src + i);
+
+        if (!node)
+            return -1;
+        if (!cplx_tail)
+            cplx_tail = node;
+        ft_lstadd_front(&cplx_list, node);
+    }
+    cplx_extra.content = cplx_src;
+    cplx_extra.next = NULL;
+    return 0;
+}
+
+static double cplx_term(e_cplx_class class, double n) {
+    switch (class) {
+    case CPLX_O1: return 0.0;
+    case CPLX_OLOGN: return log2(n);
+    case CPLX_ON: return n;
+    case CPLX_ONLOGN: return n * log2(n);
+    default: return n * n;
+    }
+}
+
+// Weighted least squares fit of t = a + b * f(n) with a, b >= 0; returns the
+// weighted residual sum of squares (relative error squared per point), or -1
+// when the f(n) term is under CPLX_NEGLIGIBLE of the largest time, where the
+// fit is just O(1) again
+static double cplx_fit(e_cplx_class class, const double *n, const double *t, size_t count) {
+    double s = 0, sf = 0, sff = 0, st = 0, sft = 0;
+    double a;
+    double b = 0.0;
+    double rss = 0.0;
+
+    for (size_t i = 0; i < count; i++) {
+        double w = 1.0 / (t[i] * t[i]);
+        double f = cplx_term(class, n[i]);
+
+        s += w;
+        sf += w * f;
+        sff += w * f * f;
+        st += w * t[i];
+        sft += w * f * t[i];
+    }
+    a = st / s;
+    if (class != CPLX_O1 && s * sff - sf * sf > 0) {
+        b = (s * sft - sf * st) / (s * sff - sf * sf);
+        a = (st * sff - sf * sft) / (s * sff - sf * sf);
+        if (b < 0) {
+            b = 0.0;
+            a = st / s;
+        } else if (a < 0) {
+            a = 0.0;
+            b = sft / sff;
+        }
+    }
+    if (class != CPLX_O1 && b * cplx_term(class, n[count - 1]) <= CPLX_NEGLIGIBLE * t[count - 1])
+        return -1.0;
+    for (size_t i = 0; i < count; i++) {
+        double r = (t[i] - a - b * cplx_term(class, n[i])) / t[i];
+        rss += r * r;
+    }
+    return rss;
+}
+
+// Helper function to time one size, spending about CPLX_CELL_BUDGET_NS on it
+static double cplx_time(void (*kernel)(void), const t_bench_config *base) {
+    t_bench_config config = *base;
+    t_bench_stats stats;
+    double probe = measure_time_ns(kernel, 1);
+    size_t affordable = (size_t)(CPLX_CELL_BUDGET_NS / (probe > 1.0 ? probe : 1.0));
+
+    if (config.iterations > affordable)
+        config.iterations = affordable < CPLX_MIN_ITERATIONS ? CPLX_MIN_ITERATIONS : affordable;
+    if (run_benchmark(kernel, &config, &stats) != 0)
+        return probe;
+    return stats.median_ns;
+}
+
+#define CPLX_CASE_COUNT (sizeof(cplx_cases) / sizeof(*cplx_cases))
+
+// Helper function to time every selected kernel (all of them when selected is
+// NULL) at every size, building each size's inputs once. Returns the number
+// of sizes measured
+static size_t cplx_collect(size_t max_size, double *sizes, double times[][CPLX_MAX_POINTS],
+                           const char *selected) {
+    t_bench_config base = bench_default_config();
+    size_t points = 0;
+
+    for (size_t n = CPLX_MIN_SIZE; n <= max_size && points < CPLX_MAX_POINTS; n *= 2) {
+        if (cplx_prepare(n) != 0) {
+            printf("  \033[1;31mComplexity detection stopped at n = %zu: allocation failed\033[0m\n", n);
+            break;
+        }
+        for (size_t c = 0; c < CPLX_CASE_COUNT; c++) {
+            if (!selected || selected[c])
+                times[c][points] = cplx_time(cplx_cases[c].kernel, &base);
+        }
+        sizes[points++] = (double)n;
+    }
+    cplx_list_free();
+    return points;
+}
+
+// Helper function to fit log t = k + e log n; e is the growth exponent
+static double cplx_exponent(const double *n, const double *t, size_t count) {
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        double x = log(n[i]);
+        double y = log(t[i]);
+
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+    return (count * sxy - sx * sy) / (count * sxx - sx * sx);
+}
+
+typedef struct s_cplx_fit {
+    int best;
+    int next;                   // runner-up class, or -1
+    double confidence;          // percent
+    double exponent;            // log-log slope over the fitted sizes
+} t_cplx_fit;
+
+// Helper function to fit one kernel's times to every class
+static t_cplx_fit cplx_classify(const double *sizes, const double *times, size_t points) {
+    // Fit the upper half, where the leading term dominates call overhead
+    size_t first = points / 2 < points - 4 ? points / 2 : points - 4;
+    double rss[CPLX_CLASS_COUNT];
+    t_cplx_fit fit = {CPLX_O1, -1, 100.0, 0.0};
+
+    for (int k = 0; k < CPLX_CLASS_COUNT; k++) {
+        rss[k] = cplx_fit((e_cplx_class)k, sizes + first, times + first, points - first);
+        if (rss[k] >= 0 && rss[k] < rss[fit.best] * CPLX_OCCAM)
+            fit.best = k;
+    }
+    for (int k = 0; k < CPLX_CLASS_COUNT; k++) {
+        if (k != fit.best && rss[k] >= 0 && (fit.next < 0 || rss[k] < rss[fit.next]))
+            fit.next = k;
+    }
+    // 0% when the runner-up fits as well as the winner, 100% when the
+    // winner fits perfectly or nothing else fits at all
+    if (fit.next >= 0 && rss[fit.next] > 0)
+        fit.confidence = 100.0 * (1.0 - rss[fit.best] / rss[fit.next]);
+    if (fit.confidence < 0)
+        fit.confidence = 0;
+    fit.exponent = cplx_exponent(sizes + first, times + first, points - first);
+    return fit;
+}
+
+// Helper function to tell strong evidence of a regression from noise: the
+// class must be of a higher degree than expected and win with at least
+// CPLX_GATE_CONFIDENCE, and the measured exponent must clear the expected
+// degree by CPLX_EXPONENT_MARGIN, so O(n) only fails from about n^1.4 up
+static int cplx_suspect(const t_cplx_case *entry, const t_cplx_fit *fit) {
+    return cplx_degree[fit->best] > cplx_degree[entry->expected]
+        && fit->confidence >= CPLX_GATE_CONFIDENCE
+        && fit->exponent > cplx_degree[entry->expected] + CPLX_EXPONENT_MARGIN;
+}
+
+// Helper function to fit and print one kernel's class; returns 1 when the
+// fit is strong evidence of a higher degree than the expected one. A weaker
+// mismatch is printed as a warning and returns 0
+static int cplx_report(const t_cplx_case *entry, const double *sizes, const double *times, size_t points) {
+    t_cplx_fit fit = cplx_classify(sizes, times, points);
+
+    printf("  \033[1;36m%-12s %10.1f %10.1f  n^%-5.2f %-10s %9.0f%%  %-10s\033[0m",
+           entry->name, times[0], times[points - 1], fit.exponent,
+           cplx_class_names[fit.best], fit.confidence, fit.next >= 0 ? cplx_class_names[fit.next] : "-");
+    if (cplx_suspect(entry, &fit)) {
+        printf("  \033[1;31mexpected %s\033[0m\n", cplx_class_names[entry->expected]);
+        return 1;
+    }
+    if (cplx_degree[fit.best] > cplx_degree[entry->expected])
+        printf("  \033[1;33mexpected %s (weak fit, not counted)\033[0m\n", cplx_class_names[entry->expected]);
+    else
+        printf("\n");
+    return 0;
+}
+
+// Helper function to measure the suspects again; a function stays a suspect
+// only while every pass repeats the evidence. Returns the suspects left
+static int cplx_confirm(size_t max_size, size_t passes, size_t points, double times[][CPLX_MAX_POINTS],
+                        char *suspects) {
+    double sizes[CPLX_MAX_POINTS];
+    int left = 0;
+
+    for (size_t c = 0; c < CPLX_CASE_COUNT; c++)
+        left += suspects[c];
+    for (size_t pass = 2; pass <= passes && left > 0; pass++) {
+        if (cplx_collect(max_size, sizes, times, suspects) != points) {
+            printf("  \033[1;33mCould not repeat the measurement; mismatches are not counted\033[0m\n");
+            memset(suspects, 0, CPLX_CASE_COUNT);
+            return 0;
+        }
+        for (size_t c = 0; c < CPLX_CASE_COUNT; c++) {
+            t_cplx_fit fit;
+
+            if (!suspects[c])
+                continue;
+            fit = cplx_classify(sizes, times[c], points);
+            printf("  \033[1;36m%-12s pass %zu/%zu: n^%-5.2f %-10s %3.0f%%\033[0m", cplx_cases[c].name,
+                   pass, passes, fit.exponent, cplx_class_names[fit.best], fit.confidence);
+            if (cplx_suspect(&cplx_cases[c], &fit)) {
+                printf("\n");
+                continue;
+            }
+            printf("  \033[1;33mnot repeated, not counted\033[0m\n");
+            suspects[c] = 0;
+            left--;
+        }
+    }
+    return left;
+}
+
+int run_complexity_detection(void) {
+    static double times[CPLX_CASE_COUNT][CPLX_MAX_POINTS];
+    size_t max_size = bench_env_size("BENCH_COMPLEXITY_MAX", CPLX_DEFAULT_MAX);
+    size_t passes = bench_env_size("BENCH_COMPLEXITY_PASSES", CPLX_DEFAULT_PASSES);
+    double sizes[CPLX_MAX_POINTS];
+    char suspects[CPLX_CASE_COUNT] = {0};
+    size_t points = 0;
+    int mismatches = 0;
+
+    if (max_size < CPLX_MIN_SIZE * 8)
+        max_size = CPLX_MIN_SIZE * 8;
+    cplx_src = malloc(max_size + 1);
+    cplx_padded = malloc(max_size + 9);
+    cplx_dst = malloc(2 * max_size + 1);
+    if (cplx_src && cplx_padded && cplx_dst)
+        points = cplx_collect(max_size, sizes, times, NULL);
+    else
+        printf("  \033[1;31mComplexity detection skipped: allocation failed\033[0m\n");
+    if (points >= 4) {
+        printf("  \033[1m%-12s %10s %10s  %-7s %-10s %10s  %-10s\033[0m   (n = %zu..%.0f)\n", "",
+               "ns @ min", "ns @ max", "growth", "class", "confidence", "runner-up", CPLX_MIN_SIZE,
+               sizes[points - 1]);
+        for (size_t c = 0; c < CPLX_CASE_COUNT; c++)
+            suspects[c] = (char)cplx_report(&cplx_cases[c], sizes, times[c], points);
+        mismatches = cplx_confirm(max_size, passes, points, times, suspects);
+    } else if (cplx_src && cplx_padded && cplx_dst) {
+        printf("  Not enough sizes to fit a class; raise BENCH_COMPLEXITY_MAX\n");
+    }
+    free(cplx_src);
+    free(cplx_padded);
+    free(cplx_dst);
+    cplx_src = NULL;
+    cplx_padded = NULL;
+    cplx_dst = NULL;
+    if (mismatches)
+        printf("  \033[1;31m%d function(s) grow faster than they need to in all %zu passes\033[0m\n",
+               mismatches, passes);
+    return mismatches;
+}
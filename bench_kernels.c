@@ -0,0 +1,723 @@
+#include "test_libft.h"
+
+// Benchmark kernels: each exercises only the ft_ function on a realistic
+// input, with no assertions, so the timing is the function itself
+static char bench_text[BENCH_TEXT_SIZE];
+static char bench_text_copy[BENCH_TEXT_SIZE];
+static char bench_padded[BENCH_TEXT_SIZE];
+static char bench_sentence[BENCH_SENTENCE_SIZE];
+static char bench_numbers[BENCH_NUMBER_COUNT][16];
+static unsigned char bench_bytes_random[BENCH_TEXT_SIZE];
+static unsigned char bench_bytes_sorted[BENCH_TEXT_SIZE];
+
+// Helper function for deterministic pseudo-random benchmark inputs
+static uint32_t bench_rand_state = 0x2545F491u;
+
+static uint32_t bench_rand(void) {
+    bench_rand_state ^= bench_rand_state << 13;
+    bench_rand_state ^= bench_rand_state >> 17;
+    bench_rand_state ^= bench_rand_state << 5;
+    return bench_rand_state;
+}
+
+// Helper function to fill dst with space-separated words (NUL-terminated)
+static void bench_fill_words(char *dst, size_t size) {
+    static const char *words[] = {
+        "GET", "/api/v1/users", "Host:", "example.com", "Content-Length:",
+        "1024", "keep-alive", "Accept:", "text/html", "gzip", "token", "42"
+    };
+    size_t pos = 0;
+
+    while (pos + 1 < size) {
+        const char *word = words[bench_rand() % (sizeof(words) / sizeof(*words))];
+        while (*word && pos + 1 < size)
+            dst[pos++] = *word++;
+        if (pos + 1 < size)
+            dst[pos++] = ' ';
+    }
+    dst[pos] = '\0';
+}
+
+// Build all benchmark inputs once, before any kernel runs
+void bench_setup(void) {
+    bench_fill_words(bench_text, sizeof(bench_text));
+    memcpy(bench_text_copy, bench_text, sizeof(bench_text));
+    bench_fill_words(bench_sentence, sizeof(bench_sentence));
+    memset(bench_padded, ' ', sizeof(bench_padded));
+    bench_fill_words(bench_padded + 64, sizeof(bench_padded) - 128);
+    bench_padded[strlen(bench_padded)] = ' ';
+    bench_padded[sizeof(bench_padded) - 1] = '\0';
+    for (int i = 0; i < BENCH_NUMBER_COUNT; i++) {
+        snprintf(bench_numbers[i], sizeof(bench_numbers[i]), "%d", (int)bench_rand());
+    }
+    // Uniform random bytes, and the same bytes in ascending order
+    size_t histogram[UCHAR_MAX + 1] = {0};
+    size_t pos = 0;
+    for (size_t i = 0; i < BENCH_TEXT_SIZE; i++) {
+        bench_bytes_random[i] = (unsigned char)bench_rand();
+        histogram[bench_bytes_random[i]]++;
+    }
+    for (int c = 0; c <= UCHAR_MAX; c++) {
+        for (size_t n = 0; n < histogram[c]; n++)
+            bench_bytes_sorted[pos++] = (unsigned char)c;
+    }
+}
+
+void bench_isalpha(void) {
+    int count = 0;
+    BENCH_ESCAPE(bench_text);
+    for (size_t i = 0; i < BENCH_TEXT_SIZE; i++)
+        count += ft_isalpha((unsigned char)bench_text[i]) != 0;
+    BENCH_KEEP(count);
+}
+
+void bench_isdigit(void) {
+    int count = 0;
+    BENCH_ESCAPE(bench_text);
+    for (size_t i = 0; i < BENCH_TEXT_SIZE; i++)
+        count += ft_isdigit((unsigned char)bench_text[i]) != 0;
+    BENCH_KEEP(count);
+}
+
+void bench_isalnum(void) {
+    int count = 0;
+    BENCH_ESCAPE(bench_text);
+    for (size_t i = 0; i < BENCH_TEXT_SIZE; i++)
+        count += ft_isalnum((unsigned char)bench_text[i]) != 0;
+    BENCH_KEEP(count);
+}
+
+void bench_isprint(void) {
+    int count = 0;
+    BENCH_ESCAPE(bench_text);
+    for (size_t i = 0; i < BENCH_TEXT_SIZE; i++)
+        count += ft_isprint((unsigned char)bench_text[i]) != 0;
+    BENCH_KEEP(count);
+}
+
+void bench_toupper(void) {
+    int acc = 0;
+    BENCH_ESCAPE(bench_text);
+    for (size_t i = 0; i < BENCH_TEXT_SIZE; i++)
+        acc += ft_toupper((unsigned char)bench_text[i]);
+    BENCH_KEEP(acc);
+}
+
+// Branchy ft_ classifiers against the ctype_flags/ctype_upper tables in a
+// tokenizer-style loop. Random bytes defeat the branch predictor; the same
+// bytes sorted make every branch predictable
+
+#define CTYPE_BENCH_KERNEL(name, bytes, expr) \
+    void bench_##name(void) { \
+        int acc = 0; \
+        BENCH_ESCAPE(bytes); \
+        for (size_t i = 0; i < BENCH_TEXT_SIZE; i++) { \
+            int c = bytes[i]; \
+            acc += (expr); \
+        } \
+        BENCH_KEEP(acc); \
+    }
+
+CTYPE_BENCH_KERNEL(alnum_rand, bench_bytes_random, ft_isalnum(c) != 0)
+CTYPE_BENCH_KERNEL(alnum_lut_rand, bench_bytes_random, (ctype_flags[c] & (CTYPE_ALPHA | CTYPE_DIGIT)) != 0)
+CTYPE_BENCH_KERNEL(alnum_sort, bench_bytes_sorted, ft_isalnum(c) != 0)
+CTYPE_BENCH_KERNEL(alnum_lut_sort, bench_bytes_sorted, (ctype_flags[c] & (CTYPE_ALPHA | CTYPE_DIGIT)) != 0)
+CTYPE_BENCH_KERNEL(upper_rand, bench_bytes_random, ft_toupper(c))
+CTYPE_BENCH_KERNEL(upper_lut_rand, bench_bytes_random, ctype_upper[c])
+CTYPE_BENCH_KERNEL(upper_sort, bench_bytes_sorted, ft_toupper(c))
+CTYPE_BENCH_KERNEL(upper_lut_sort, bench_bytes_sorted, ctype_upper[c])
+
+void bench_strlen(void) {
+    BENCH_ESCAPE(bench_text);
+    BENCH_KEEP(ft_strlen(bench_text));
+}
+
+void bench_strchr(void) {
+    BENCH_ESCAPE(bench_text);
+    BENCH_KEEP(ft_strchr(bench_text, '\n'));
+}
+
+void bench_strrchr(void) {
+    BENCH_ESCAPE(bench_text);
+    BENCH_KEEP(ft_strrchr(bench_text, 'G'));
+}
+
+void bench_strncmp(void) {
+    BENCH_ESCAPE(bench_text);
+    BENCH_ESCAPE(bench_text_copy);
+    BENCH_KEEP(ft_strncmp(bench_text, bench_text_copy, BENCH_TEXT_SIZE));
+}
+
+void bench_strnstr(void) {
+    BENCH_ESCAPE(bench_text);
+    BENCH_KEEP(ft_strnstr(bench_text, "X-Request-Id:", BENCH_TEXT_SIZE));
+}
+
+void bench_atoi(void) {
+    unsigned int acc = 0;     // wraps; a signed sum would overflow
+    BENCH_ESCAPE(bench_numbers);
+    for (int i = 0; i < BENCH_NUMBER_COUNT; i++)
+        acc += (unsigned int)ft_atoi(bench_numbers[i]);
+    BENCH_KEEP(acc);
+}
+
+// Allocating kernels still free their results; that cost is part of the API
+void bench_strdup(void) {
+    char *dup = ft_strdup(bench_sentence);
+    BENCH_ESCAPE(dup);
+    free(dup);
+}
+
+void bench_substr(void) {
+    char *sub = ft_substr(bench_text, 128, 256);
+    BENCH_ESCAPE(sub);
+    free(sub);
+}
+
+void bench_strjoin(void) {
+    char *joined = ft_strjoin(bench_sentence, bench_sentence);
+    BENCH_ESCAPE(joined);
+    free(joined);
+}
+
+void bench_strtrim(void) {
+    char *trimmed = ft_strtrim(bench_padded, " ");
+    BENCH_ESCAPE(trimmed);
+    free(trimmed);
+}
+
+void bench_split(void) {
+    char **words = ft_split(bench_sentence, ' ');
+    BENCH_ESCAPE(words);
+    if (!words)
+        return;
+    for (size_t i = 0; words[i]; i++)
+        free(words[i]);
+    free(words);
+}
+
+void bench_itoa(void) {
+    for (int i = 0; i < BENCH_NUMBER_COUNT; i++) {
+        char *str = ft_itoa((int)(i * 104729) - 3000000);
+        BENCH_ESCAPE(str);
+        free(str);
+    }
+}
+
+// Size-sweep throughput suite for the mem* family. Enabled with BENCH_SWEEP=1;
+// BENCH_SWEEP_MAX caps the largest buffer (default 256 MiB)
+#define SWEEP_DEFAULT_MAX ((size_t)256 << 20)
+#define SWEEP_BYTES_PER_CELL ((size_t)1 << 30)
+#define SWEEP_MIN_ITERATIONS 5
+
+static unsigned char *sweep_src;
+static unsigned char *sweep_dst;
+static size_t sweep_size;
+
+void bench_sweep_memset(void) {
+    BENCH_KEEP(ft_memset(sweep_dst, 'A', sweep_size));
+    BENCH_ESCAPE(sweep_dst);
+}
+
+void bench_sweep_bzero(void) {
+    ft_bzero(sweep_dst, sweep_size);
+    BENCH_ESCAPE(sweep_dst);
+}
+
+void bench_sweep_memcpy(void) {
+    BENCH_KEEP(ft_memcpy(sweep_dst, sweep_src, sweep_size));
+    BENCH_ESCAPE(sweep_dst);
+}
+
+void bench_sweep_memmove(void) {
+    BENCH_KEEP(ft_memmove(sweep_dst, sweep_src, sweep_size));
+    BENCH_ESCAPE(sweep_dst);
+}
+
+// Searches for a byte that is never present, so the whole buffer is scanned
+void bench_sweep_memchr(void) {
+    BENCH_ESCAPE(sweep_src);
+    BENCH_KEEP(ft_memchr(sweep_src, 0xFF, sweep_size));
+}
+
+// Compares identical buffers, so the whole range is compared
+void bench_sweep_memcmp(void) {
+    BENCH_ESCAPE(sweep_src);
+    BENCH_ESCAPE(sweep_dst);
+    BENCH_KEEP(ft_memcmp(sweep_src, sweep_dst, sweep_size));
+}
+
+typedef struct s_sweep_case {
+    const char *name;
+    void (*kernel)(void);
+    int needs_equal;    // dst must mirror src before timing (memcmp)
+} t_sweep_case;
+
+static const t_sweep_case sweep_cases[] = {
+    {"memset", bench_sweep_memset, 0},
+    {"bzero", bench_sweep_bzero, 0},
+    {"memcpy", bench_sweep_memcpy, 0},
+    {"memmove", bench_sweep_memmove, 0},
+    {"memchr", bench_sweep_memchr, 0},
+    {"memcmp", bench_sweep_memcmp, 1},
+};
+
+// Helper function to format a byte count as B/KiB/MiB
+static void format_size(char *buf, size_t buf_size, size_t bytes) {
+    if (bytes >= ((size_t)1 << 20) && bytes % ((size_t)1 << 20) == 0)
+        snprintf(buf, buf_size, "%zu MiB", bytes >> 20);
+    else if (bytes >= 1024 && bytes % 1024 == 0)
+        snprintf(buf, buf_size, "%zu KiB", bytes >> 10);
+    else
+        snprintf(buf, buf_size, "%zu B", bytes);
+}
+
+// Helper function to name the cache level a working set first spills out of
+static const char *sweep_cache_marker(size_t prev, size_t size) {
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    long levels[3] = {
+        sysconf(_SC_LEVEL1_DCACHE_SIZE),
+        sysconf(_SC_LEVEL2_CACHE_SIZE),
+        sysconf(_SC_LEVEL3_CACHE_SIZE)
+    };
+    static const char *names[3] = {"> L1d", "> L2", "> LLC"};
+
+    for (int i = 2; i >= 0; i--) {
+        if (levels[i] > 0 && prev <= (size_t)levels[i] && size > (size_t)levels[i])
+            return names[i];
+    }
+#else
+    (void)prev;
+    (void)size;
+#endif
+    return "";
+}
+
+void run_mem_size_sweep(void) {
+    const size_t ncases = sizeof(sweep_cases) / sizeof(*sweep_cases);
+    t_bench_config base = bench_default_config();
+    size_t max_size = bench_env_size("BENCH_SWEEP_MAX", SWEEP_DEFAULT_MAX);
+    char label[32];
+
+    // Fall back to smaller buffers if the machine cannot hold two of max_size
+    while (max_size > 1) {
+        sweep_src = malloc(max_size);
+        sweep_dst = malloc(max_size);
+        if (sweep_src && sweep_dst)
+            break;
+        free(sweep_src);
+        free(sweep_dst);
+        sweep_src = NULL;
+        sweep_dst = NULL;
+        max_size /= 2;
+    }
+    if (!sweep_src) {
+        printf("  \033[1;31mSize sweep skipped: allocation failed\033[0m\n");
+        return;
+    }
+    // Fault every page in before timing; 0xFF never appears for memchr
+    memset(sweep_src, 'B', max_size);
+    memset(sweep_dst, 'B', max_size);
+
+    printf("  \033[1m%10s", "size");
+    for (size_t c = 0; c < ncases; c++)
+        printf(" %9s", sweep_cases[c].name);
+    printf("   (GB/s, median)\033[0m\n");
+
+    for (size_t size = 1, prev = 0; size <= max_size; prev = size, size *= 2) {
+        t_bench_config config = base;
+        size_t budget = SWEEP_BYTES_PER_CELL / size;
+
+        if (config.iterations > budget)
+            config.iterations = budget < SWEEP_MIN_ITERATIONS ? SWEEP_MIN_ITERATIONS : budget;
+        if (config.warmup > budget)
+            config.warmup = 1;
+        sweep_size = size;
+        format_size(label, sizeof(label), size);
+        printf("  %10s", label);
+        for (size_t c = 0; c < ncases; c++) {
+            t_bench_stats stats;
+
+            if (sweep_cases[c].needs_equal)
+                memcpy(sweep_dst, sweep_src, size);
+            if (run_benchmark(sweep_cases[c].kernel, &config, &stats) != 0) {
+                printf(" %9s", "n/a");
+                continue;
+            }
+            // bytes per nanosecond == GB/s
+            printf(" %9.2f", (double)size / stats.median_ns);
+        }
+        printf("  %s\n", sweep_cache_marker(prev, size));
+        fflush(stdout);
+    }
+    free(sweep_src);
+    free(sweep_dst);
+    sweep_src = NULL;
+    sweep_dst = NULL;
+}
+
+// Differential benchmarks: each ft_ function against its libc counterpart on
+// identical inputs, reported as a time ratio per size class. Enabled with
+// BENCH_COMPARE=1
+#if defined(__APPLE__)
+# define HAVE_LIBC_STRLCPY 1
+#elif defined(__GLIBC__)
+# if __GLIBC_PREREQ(2, 38)
+#  define HAVE_LIBC_STRLCPY 1
+# endif
+#endif
+
+static const size_t compare_sizes[] = {16, 256, 4096, 65536};
+#define COMPARE_NSIZES (sizeof(compare_sizes) / sizeof(*compare_sizes))
+#define COMPARE_MAX_SIZE 65536
+
+static char *compare_src;
+static char *compare_dst;
+static size_t compare_size;
+
+// Kernel generators: one body per expression, so ft_ and libc sides are
+// structurally identical and differ only in the call being timed
+#define COMPARE_KERNEL(name, expr) \
+    static void compare_##name(void) { \
+        BENCH_ESCAPE(compare_src); \
+        BENCH_ESCAPE(compare_dst); \
+        BENCH_KEEP(expr); \
+    }
+#define COMPARE_VOID_KERNEL(name, stmt) \
+    static void compare_##name(void) { \
+        BENCH_ESCAPE(compare_src); \
+        stmt; \
+        BENCH_ESCAPE(compare_dst); \
+    }
+#define COMPARE_ALLOC_KERNEL(name, expr) \
+    static void compare_##name(void) { \
+        void *result; \
+        BENCH_ESCAPE(compare_src); \
+        result = (expr); \
+        BENCH_ESCAPE(result); \
+        free(result); \
+    }
+#define COMPARE_CTYPE_KERNEL(name, fn) \
+    static void compare_##name(void) { \
+        int acc = 0; \
+        BENCH_ESCAPE(compare_src); \
+        for (size_t i = 0; i < compare_size; i++) \
+            acc += fn((unsigned char)compare_src[i]) != 0; \
+        BENCH_KEEP(acc); \
+    }
+
+COMPARE_CTYPE_KERNEL(ft_isalpha, ft_isalpha)
+COMPARE_CTYPE_KERNEL(isalpha, isalpha)
+COMPARE_CTYPE_KERNEL(ft_isdigit, ft_isdigit)
+COMPARE_CTYPE_KERNEL(isdigit, isdigit)
+COMPARE_CTYPE_KERNEL(ft_isalnum, ft_isalnum)
+COMPARE_CTYPE_KERNEL(isalnum, isalnum)
+COMPARE_CTYPE_KERNEL(ft_isascii, ft_isascii)
+COMPARE_CTYPE_KERNEL(isascii, isascii)
+COMPARE_CTYPE_KERNEL(ft_isprint, ft_isprint)
+COMPARE_CTYPE_KERNEL(isprint, isprint)
+COMPARE_CTYPE_KERNEL(ft_toupper, ft_toupper)
+COMPARE_CTYPE_KERNEL(toupper, toupper)
+COMPARE_CTYPE_KERNEL(ft_tolower, ft_tolower)
+COMPARE_CTYPE_KERNEL(tolower, tolower)
+
+COMPARE_KERNEL(ft_strlen, ft_strlen(compare_src))
+COMPARE_KERNEL(strlen, strlen(compare_src))
+COMPARE_KERNEL(ft_strchr, ft_strchr(compare_src, '\x01'))
+COMPARE_KERNEL(strchr, strchr(compare_src, '\x01'))
+COMPARE_KERNEL(ft_strrchr, ft_strrchr(compare_src, '\x01'))
+COMPARE_KERNEL(strrchr, strrchr(compare_src, '\x01'))
+COMPARE_KERNEL(ft_strncmp, ft_strncmp(compare_src, compare_dst, compare_size))
+COMPARE_KERNEL(strncmp, strncmp(compare_src, compare_dst, compare_size))
+// The haystack is NUL-terminated at compare_size, so a strnstr bounded by
+// compare_size has exactly strstr's semantics
+COMPARE_KERNEL(ft_strnstr, ft_strnstr(compare_src, "X-Request-Id:", compare_size))
+COMPARE_KERNEL(strstr, strstr(compare_src, "X-Request-Id:"))
+#ifdef HAVE_LIBC_STRLCPY
+COMPARE_KERNEL(ft_strlcpy, ft_strlcpy(compare_dst, compare_src, compare_size + 1))
+COMPARE_KERNEL(ft_strlcat, (compare_dst[0] = '\0', ft_strlcat(compare_dst, compare_src, compare_size + 1)))
+COMPARE_KERNEL(strlcpy, strlcpy(compare_dst, compare_src, compare_size + 1))
+COMPARE_KERNEL(strlcat, (compare_dst[0] = '\0', strlcat(compare_dst, compare_src, compare_size + 1)))
+#endif
+COMPARE_KERNEL(ft_memset, ft_memset(compare_dst, 'A', compare_size))
+COMPARE_KERNEL(memset, memset(compare_dst, 'A', compare_size))
+COMPARE_VOID_KERNEL(ft_bzero, ft_bzero(compare_dst, compare_size))
+COMPARE_VOID_KERNEL(bzero, memset(compare_dst, 0, compare_size))
+COMPARE_KERNEL(ft_memcpy, ft_memcpy(compare_dst, compare_src, compare_size))
+COMPARE_KERNEL(memcpy, memcpy(compare_dst, compare_src, compare_size))
+COMPARE_KERNEL(ft_memmove, ft_memmove(compare_dst, compare_src, compare_size))
+COMPARE_KERNEL(memmove, memmove(compare_dst, compare_src, compare_size))
+COMPARE_KERNEL(ft_memchr, ft_memchr(compare_src, '\x01', compare_size))
+COMPARE_KERNEL(memchr, memchr(compare_src, '\x01', compare_size))
+COMPARE_KERNEL(ft_memcmp, ft_memcmp(compare_src, compare_dst, compare_size))
+COMPARE_KERNEL(memcmp, memcmp(compare_src, compare_dst, compare_size))
+COMPARE_ALLOC_KERNEL(ft_calloc, ft_calloc(compare_size, 1))
+COMPARE_ALLOC_KERNEL(calloc, calloc(compare_size, 1))
+COMPARE_ALLOC_KERNEL(ft_strdup, ft_strdup(compare_src))
+COMPARE_ALLOC_KERNEL(strdup, strdup(compare_src))
+COMPARE_ALLOC_KERNEL(ft_substr, ft_substr(compare_src, 0, compare_size))
+COMPARE_ALLOC_KERNEL(strndup, strndup(compare_src, compare_size))
+
+// ft_atoi against atoi over the shared number table; size-independent
+static void compare_ft_atoi(void) {
+    unsigned int acc = 0;
+    BENCH_ESCAPE(bench_numbers);
+    for (int i = 0; i < BENCH_NUMBER_COUNT; i++)
+        acc += (unsigned int)ft_atoi(bench_numbers[i]);
+    BENCH_KEEP(acc);
+}
+
+static void compare_atoi(void) {
+    unsigned int acc = 0;
+    BENCH_ESCAPE(bench_numbers);
+    for (int i = 0; i < BENCH_NUMBER_COUNT; i++)
+        acc += (unsigned int)atoi(bench_numbers[i]);
+    BENCH_KEEP(acc);
+}
+
+typedef struct s_compare_case {
+    const char *name;
+    void (*ft_kernel)(void);
+    void (*libc_kernel)(void);
+    int sized;          // 0 when the kernel ignores compare_size
+    int needs_equal;    // dst must mirror src before timing
+} t_compare_case;
+
+#define COMPARE_CASE(ft, libc, sized, equal) {#ft, compare_##ft, compare_##libc, sized, equal}
+
+static const t_compare_case compare_cases[] = {
+    COMPARE_CASE(ft_isalpha, isalpha, 1, 0),
+    COMPARE_CASE(ft_isdigit, isdigit, 1, 0),
+    COMPARE_CASE(ft_isalnum, isalnum, 1, 0),
+    COMPARE_CASE(ft_isascii, isascii, 1, 0),
+    COMPARE_CASE(ft_isprint, isprint, 1, 0),
+    COMPARE_CASE(ft_toupper, toupper, 1, 0),
+    COMPARE_CASE(ft_tolower, tolower, 1, 0),
+    COMPARE_CASE(ft_strlen, strlen, 1, 0),
+    COMPARE_CASE(ft_strchr, strchr, 1, 0),
+    COMPARE_CASE(ft_strrchr, strrchr, 1, 0),
+    COMPARE_CASE(ft_strncmp, strncmp, 1, 1),
+    COMPARE_CASE(ft_strnstr, strstr, 1, 0),
+#ifdef HAVE_LIBC_STRLCPY
+    COMPARE_CASE(ft_strlcpy, strlcpy, 1, 0),
+    COMPARE_CASE(ft_strlcat, strlcat, 1, 0),
+#endif
+    COMPARE_CASE(ft_memset, memset, 1, 0),
+    COMPARE_CASE(ft_bzero, bzero, 1, 0),
+    COMPARE_CASE(ft_memcpy, memcpy, 1, 0),
+    COMPARE_CASE(ft_memmove, memmove, 1, 0),
+    COMPARE_CASE(ft_memchr, memchr, 1, 0),
+    COMPARE_CASE(ft_memcmp, memcmp, 1, 1),
+    COMPARE_CASE(ft_calloc, calloc, 1, 0),
+    COMPARE_CASE(ft_strdup, strdup, 1, 0),
+    COMPARE_CASE(ft_substr, strndup, 1, 0),
+    COMPARE_CASE(ft_atoi, atoi, 0, 0),
+};
+
+// Helper function to set up the shared input for one size class
+static void compare_prepare(size_t size, int needs_equal) {
+    compare_size = size;
+    memcpy(compare_src, bench_text, size < BENCH_TEXT_SIZE ? size : BENCH_TEXT_SIZE);
+    for (size_t off = BENCH_TEXT_SIZE; off < size; off += BENCH_TEXT_SIZE)
+        memcpy(compare_src + off, bench_text, size - off < BENCH_TEXT_SIZE ? size - off : BENCH_TEXT_SIZE);
+    // Strip any NUL copied from bench_text so strings run to compare_size
+    for (size_t i = 0; i < size; i++) {
+        if (compare_src[i] == '\0')
+            compare_src[i] = ' ';
+    }
+    compare_src[size] = '\0';
+    if (needs_equal)
+        memcpy(compare_dst, compare_src, size + 1);
+}
+
+void run_libc_comparison(void) {
+    const size_t ncases = sizeof(compare_cases) / sizeof(*compare_cases);
+    t_bench_config config = bench_default_config();
+    char label[32];
+
+    compare_src = malloc(COMPARE_MAX_SIZE + 1);
+    compare_dst = malloc(COMPARE_MAX_SIZE + 1);
+    if (!compare_src || !compare_dst) {
+        printf("  \033[1;31mlibc comparison skipped: allocation failed\033[0m\n");
+        free(compare_src);
+        free(compare_dst);
+        return;
+    }
+    printf("  \033[1m%-12s", "function");
+    for (size_t z = 0; z < COMPARE_NSIZES; z++) {
+        format_size(label, sizeof(label), compare_sizes[z]);
+        printf(" %9s", label);
+    }
+    printf("   (ft median / libc median; >1 means ft is slower)\033[0m\n");
+
+    for (size_t c = 0; c < ncases; c++) {
+        const t_compare_case *tc = &compare_cases[c];
+
+        printf("  %-12s", tc->name);
+        for (size_t z = 0; z < COMPARE_NSIZES; z++) {
+            t_bench_stats ft_stats;
+            t_bench_stats libc_stats;
+            double ratio;
+
+            if (!tc->sized && z > 0) {
+                printf(" %9s", "-");
+                continue;
+            }
+            compare_prepare(compare_sizes[z], tc->needs_equal);
+            if (run_benchmark(tc->ft_kernel, &config, &ft_stats) != 0) {
+                printf(" %9s", "n/a");
+                continue;
+            }
+            perf_observe(tc->name, tc->sized ? compare_sizes[z] : BENCH_NUMBER_COUNT, &ft_stats,
+                         tc->ft_kernel, &config);
+            if (run_benchmark(tc->libc_kernel, &config, &libc_stats) != 0) {
+                printf(" %9s", "n/a");
+                continue;
+            }
+            ratio = ft_stats.median_ns / libc_stats.median_ns;
+            printf(" %s%8.2fx\033[0m", ratio > 1.10 ? "\033[1;31m" : "\033[1;32m", ratio);
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+    free(compare_src);
+    free(compare_dst);
+    compare_src = NULL;
+    compare_dst = NULL;
+}
+
+// Alignment/overlap throughput matrices. Enabled with BENCH_ALIGN=1
+#define ALIGN_BENCH_SIZE 4096
+#define ALIGN_BENCH_ITERATIONS 11
+#define ALIGN_BENCH_WARMUP 2
+
+static unsigned char *align_src;
+static unsigned char *align_dst;
+
+void bench_align_memcpy(void) {
+    BENCH_KEEP(ft_memcpy(align_dst, align_src, ALIGN_BENCH_SIZE));
+    BENCH_ESCAPE(align_dst);
+}
+
+void bench_align_memmove(void) {
+    BENCH_KEEP(ft_memmove(align_dst, align_src, ALIGN_BENCH_SIZE));
+    BENCH_ESCAPE(align_dst);
+}
+
+void bench_align_libc_memmove(void) {
+    BENCH_KEEP(memmove(align_dst, align_src, ALIGN_BENCH_SIZE));
+    BENCH_ESCAPE(align_dst);
+}
+
+// Helper function to print a 64x64 GB/s matrix as a glyph heatmap
+static void print_align_heatmap(const char *name, double gbps[ALIGN_MAX_OFFSET][ALIGN_MAX_OFFSET]) {
+    static const char glyphs[] = " .:-=+*#%@";
+    const int nglyphs = (int)sizeof(glyphs) - 1;
+    double lo = gbps[0][0];
+    double hi = gbps[0][0];
+    size_t lo_s = 0, lo_d = 0;
+
+    for (size_t s = 0; s < ALIGN_MAX_OFFSET; s++) {
+        for (size_t d = 0; d < ALIGN_MAX_OFFSET; d++) {
+            if (gbps[s][d] < lo) {
+                lo = gbps[s][d];
+                lo_s = s;
+                lo_d = d;
+            }
+            if (gbps[s][d] > hi)
+                hi = gbps[s][d];
+        }
+    }
+    printf("\n  \033[1m%s, %d B copies: rows = src offset, columns = dst offset\033[0m\n", name, ALIGN_BENCH_SIZE);
+    printf("        ");
+    for (size_t d = 0; d < ALIGN_MAX_OFFSET; d++)
+        putchar(d % 10 == 0 ? '0' + (int)(d / 10) : ' ');
+    printf("\n        ");
+    for (size_t d = 0; d < ALIGN_MAX_OFFSET; d++)
+        putchar('0' + (int)(d % 10));
+    printf("\n");
+    for (size_t s = 0; s < ALIGN_MAX_OFFSET; s++) {
+        printf("  %4zu |", s);
+        for (size_t d = 0; d < ALIGN_MAX_OFFSET; d++) {
+            int idx = hi > lo ? (int)((gbps[s][d] - lo) / (hi - lo) * (nglyphs - 1) + 0.5) : nglyphs - 1;
+            putchar(glyphs[idx]);
+        }
+        printf("|\n");
+    }
+    printf("  legend: '%c' = %.2f GB/s ... '%c' = %.2f GB/s\n", glyphs[0], lo, glyphs[nglyphs - 1], hi);
+    printf("  aligned (0,0): %.2f GB/s, worst (src+%zu, dst+%zu): %.2f GB/s\n", gbps[0][0], lo_s, lo_d, lo);
+}
+
+// Helper function to fill one matrix by timing kernel at every offset pair
+static void measure_align_matrix(void (*kernel)(void), unsigned char *src_base, unsigned char *dst_base,
+                                 const t_bench_config *config, double gbps[ALIGN_MAX_OFFSET][ALIGN_MAX_OFFSET]) {
+    for (size_t s = 0; s < ALIGN_MAX_OFFSET; s++) {
+        for (size_t d = 0; d < ALIGN_MAX_OFFSET; d++) {
+            t_bench_stats stats;
+
+            align_src = src_base + s;
+            align_dst = dst_base + d;
+            gbps[s][d] = run_benchmark(kernel, config, &stats) == 0
+                ? (double)ALIGN_BENCH_SIZE / stats.median_ns : 0.0;
+        }
+    }
+}
+
+void run_align_matrix(void) {
+    static double gbps[ALIGN_MAX_OFFSET][ALIGN_MAX_OFFSET];
+    t_bench_config config = bench_default_config();
+    void *src_base = NULL;
+    void *dst_base = NULL;
+    void *overlap_base = NULL;
+    const size_t span = ALIGN_BENCH_SIZE + 2 * ALIGN_MAX_OFFSET + 256;
+
+    if (config.iterations > ALIGN_BENCH_ITERATIONS)
+        config.iterations = ALIGN_BENCH_ITERATIONS;
+    if (config.warmup > ALIGN_BENCH_WARMUP)
+        config.warmup = ALIGN_BENCH_WARMUP;
+    if (posix_memalign(&src_base, 64, span) != 0
+        || posix_memalign(&dst_base, 64, span) != 0
+        || posix_memalign(&overlap_base, 64, span) != 0) {
+        printf("  \033[1;31mAlignment matrix skipped: allocation failed\033[0m\n");
+        free(src_base);
+        free(dst_base);
+        free(overlap_base);
+        return;
+    }
+    memset(src_base, 'S', span);
+    memset(dst_base, 'D', span);
+    memset(overlap_base, 'O', span);
+
+    measure_align_matrix(bench_align_memcpy, src_base, dst_base, &config, gbps);
+    print_align_heatmap("ft_memcpy", gbps);
+    measure_align_matrix(bench_align_memmove, src_base, dst_base, &config, gbps);
+    print_align_heatmap("ft_memmove", gbps);
+
+    printf("\n  \033[1mft_memmove overlap, %d B moves (GB/s; libc memmove in brackets)\033[0m\n", ALIGN_BENCH_SIZE);
+    printf("  %8s %22s %22s\n", "distance", "forward (dst > src)", "backward (dst < src)");
+    for (size_t i = 0; i < sizeof(overlap_distances) / sizeof(*overlap_distances); i++) {
+        size_t dist = overlap_distances[i];
+
+        printf("  %8zu", dist);
+        for (int backward = 0; backward <= 1; backward++) {
+            t_bench_stats ft_stats;
+            t_bench_stats libc_stats;
+            unsigned char *lo = (unsigned char *)overlap_base + ALIGN_MAX_OFFSET;
+
+            align_src = backward ? lo + dist : lo;
+            align_dst = backward ? lo : lo + dist;
+            if (run_benchmark(bench_align_memmove, &config, &ft_stats) != 0
+                || run_benchmark(bench_align_libc_memmove, &config, &libc_stats) != 0) {
+                printf(" %22s", "n/a");
+                continue;
+            }
+            printf("      %7.2f [%7.2f]",
+                   (double)ALIGN_BENCH_SIZE / ft_stats.median_ns,
+                   (double)ALIGN_BENCH_SIZE / libc_stats.median_ns);
+        }
+        printf("\n");
+    }
+    free(src_base);
+    free(dst_base);
+    free(overlap_base);
+}
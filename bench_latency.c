@@ -0,0 +1,238 @@
+#include "test_libft.h"
+
+// Per-call latency histograms for functions that finish in a few nanoseconds.
+// Enabled with BENCH_LATENCY=1. Every call is timed on its own with a
+// serialized timestamp counter and recorded into an HDR-style log-linear
+// histogram, so the tail (p99, p99.9, max) is reported rather than averaged
+// away. BENCH_LATENCY_SAMPLES sets the calls per function (default 1000000)
+#define LATENCY_DEFAULT_SAMPLES 1000000
+#define LATENCY_WARMUP 10000
+#define LATENCY_CALIBRATE_NS 20000000ULL
+#define LATENCY_INPUTS 256          // power of two, inputs rotate per call
+#define LATENCY_SHORT_LEN 16
+#define LATENCY_SCAN_LEN 64
+
+// Histogram layout: values below 2^(HDR_SUB_BITS + 1) ticks get one bucket
+// each; above that every power of two is split into 2^HDR_SUB_BITS buckets,
+// so any recorded value is within 1 / 2^HDR_SUB_BITS (0.8%) of the truth
+#define HDR_SUB_BITS 7
+#define HDR_SUB_COUNT (1 << HDR_SUB_BITS)
+#define HDR_MAX_BITS 40
+#define HDR_BUCKETS ((HDR_MAX_BITS - HDR_SUB_BITS + 1) * HDR_SUB_COUNT)
+
+typedef struct s_hdr_histogram {
+    uint64_t counts[HDR_BUCKETS];
+    uint64_t total;
+    uint64_t max;
+} t_hdr_histogram;
+
+static size_t hdr_index(uint64_t value) {
+    int msb;
+    int shift;
+
+    if (value >= (1ULL << HDR_MAX_BITS))
+        return HDR_BUCKETS - 1;
+    if (value < 2 * HDR_SUB_COUNT)
+        return (size_t)value;
+    msb = 63 - __builtin_clzll(value);
+    shift = msb - HDR_SUB_BITS;
+    return (size_t)(shift + 1) * HDR_SUB_COUNT + (size_t)((value >> shift) - HDR_SUB_COUNT);
+}
+
+// Helper function to return the highest value that maps to a bucket
+static uint64_t hdr_bucket_value(size_t index) {
+    int shift;
+
+    if (index < 2 * HDR_SUB_COUNT)
+        return index;
+    shift = (int)(index / HDR_SUB_COUNT) - 1;
+    return (((uint64_t)(index % HDR_SUB_COUNT + HDR_SUB_COUNT) + 1) << shift) - 1;
+}
+
+static void hdr_record(t_hdr_histogram *hist, uint64_t value) {
+    hist->counts[hdr_index(value)]++;
+    hist->total++;
+    if (value > hist->max)
+        hist->max = value;
+}
+
+// Helper function to read the value at or below which a fraction of the
+// recorded calls fall
+static uint64_t hdr_percentile(const t_hdr_histogram *hist, double fraction) {
+    uint64_t rank = (uint64_t)(fraction * (double)hist->total + 0.5);
+    uint64_t seen = 0;
+
+    if (rank == 0)
+        rank = 1;
+    for (size_t i = 0; i < HDR_BUCKETS; i++) {
+        seen += hist->counts[i];
+        if (seen >= rank)
+            return hdr_bucket_value(i) < hist->max ? hdr_bucket_value(i) : hist->max;
+    }
+    return hist->max;
+}
+
+// Timestamp reads. On x86 the first read is fenced on both sides so the timed
+// call cannot start early, and rdtscp waits for the call to retire before
+// reading; aarch64 uses the virtual counter behind an isb. Elsewhere this
+// falls back to the monotonic clock, which is too coarse for tiny calls
+static inline uint64_t latency_start(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    uint32_t lo;
+    uint32_t hi;
+
+    __asm__ volatile("lfence\n\trdtsc\n\tlfence" : "=a"(lo), "=d"(hi) : : "memory");
+    return ((uint64_t)hi << 32) | lo;
+#elif defined(__aarch64__)
+    uint64_t ticks;
+
+    __asm__ volatile("isb\n\tmrs %0, cntvct_el0" : "=r"(ticks) : : "memory");
+    return ticks;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static inline uint64_t latency_stop(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    uint32_t lo;
+    uint32_t hi;
+    uint32_t aux;
+
+    __asm__ volatile("rdtscp\n\tlfence" : "=a"(lo), "=d"(hi), "=c"(aux) : : "memory");
+    return ((uint64_t)hi << 32) | lo;
+#elif defined(__aarch64__)
+    uint64_t ticks;
+
+    __asm__ volatile("isb\n\tmrs %0, cntvct_el0\n\tisb" : "=r"(ticks) : : "memory");
+    return ticks;
+#else
+    return latency_start();
+#endif
+}
+
+// Helper function to measure counter ticks per nanosecond against the
+// monotonic clock
+static double latency_ticks_per_ns(void) {
+    struct timespec ts;
+    uint64_t start_ns;
+    uint64_t now_ns;
+    uint64_t start_ticks;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    start_ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    start_ticks = latency_start();
+    do {
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        now_ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    } while (now_ns - start_ns < LATENCY_CALIBRATE_NS);
+    return (double)(latency_stop() - start_ticks) / (double)(now_ns - start_ns);
+}
+
+// Inputs rotate on every call so the branch predictor cannot learn one value
+static unsigned char latency_bytes[LATENCY_INPUTS];
+static char latency_short[LATENCY_INPUTS][LATENCY_SHORT_LEN + 1];
+static unsigned char latency_scan[LATENCY_SCAN_LEN];
+static size_t latency_next;
+
+static void latency_setup(void) {
+    uint32_t state = 0x9E3779B9u;
+    size_t len;
+
+    for (size_t i = 0; i < LATENCY_INPUTS; i++) {
+        state = state * 1664525u + 1013904223u;
+        latency_bytes[i] = (unsigned char)(state >> 24);
+        // Short strings of 1..LATENCY_SHORT_LEN characters
+        len = 1 + (state >> 8) % LATENCY_SHORT_LEN;
+        memset(latency_short[i], 'a' + (int)(i % 26), len);
+        latency_short[i][len] = '\0';
+    }
+    memset(latency_scan, 'x', sizeof(latency_scan));
+}
+
+static void latency_empty(void) {
+    BENCH_KEEP(latency_next++);
+}
+
+static void latency_strlen(void) {
+    BENCH_KEEP(ft_strlen(latency_short[latency_next++ & (LATENCY_INPUTS - 1)]));
+}
+
+static void latency_isalpha(void) {
+    BENCH_KEEP(ft_isalpha(latency_bytes[latency_next++ & (LATENCY_INPUTS - 1)]));
+}
+
+static void latency_toupper(void) {
+    BENCH_KEEP(ft_toupper(latency_bytes[latency_next++ & (LATENCY_INPUTS - 1)]));
+}
+
+// The byte searched for rotates over values never present, so every call
+// scans all LATENCY_SCAN_LEN bytes
+static void latency_memchr(void) {
+    BENCH_ESCAPE(latency_scan);
+    BENCH_KEEP(ft_memchr(latency_scan, 'a' + (int)(latency_next++ % 23), sizeof(latency_scan)));
+}
+
+typedef struct s_latency_case {
+    const char *name;
+    void (*kernel)(void);
+} t_latency_case;
+
+static const t_latency_case latency_cases[] = {
+    {"strlen", latency_strlen},
+    {"isalpha", latency_isalpha},
+    {"toupper", latency_toupper},
+    {"memchr", latency_memchr},
+};
+
+// Helper function to time samples single calls of kernel into hist, with the
+// cost of an empty timed call (overhead ticks) taken off each sample
+static void latency_measure(void (*kernel)(void), size_t samples, uint64_t overhead, t_hdr_histogram *hist) {
+    for (size_t i = 0; i < LATENCY_WARMUP; i++)
+        kernel();
+    for (size_t i = 0; i < samples; i++) {
+        uint64_t start = latency_start();
+        kernel();
+        uint64_t ticks = latency_stop() - start;
+
+        hdr_record(hist, ticks > overhead ? ticks - overhead : 0);
+    }
+}
+
+void run_latency_histograms(void) {
+    const size_t ncases = sizeof(latency_cases) / sizeof(*latency_cases);
+    size_t samples = bench_env_size("BENCH_LATENCY_SAMPLES", LATENCY_DEFAULT_SAMPLES);
+    t_hdr_histogram *hist = malloc(sizeof(*hist));
+    double ticks_per_ns;
+    uint64_t overhead;
+
+    if (!hist) {
+        printf("  \033[1;31mLatency histograms skipped: allocation failed\033[0m\n");
+        return;
+    }
+    latency_setup();
+    ticks_per_ns = latency_ticks_per_ns();
+    // The median of the empty call is the fixed cost of timing one call
+    memset(hist, 0, sizeof(*hist));
+    latency_measure(latency_empty, samples, 0, hist);
+    overhead = hdr_percentile(hist, 0.5);
+    printf("  Counter %.2f ticks/ns, timing overhead %llu ticks subtracted per call\n",
+           ticks_per_ns, (unsigned long long)overhead);
+    printf("  \033[1m%-10s %9s %9s %9s %9s %9s\033[0m   (ns per call, %zu calls)\n",
+           "", "p50", "p90", "p99", "p99.9", "max", samples);
+    for (size_t c = 0; c < ncases; c++) {
+        memset(hist, 0, sizeof(*hist));
+        latency_measure(latency_cases[c].kernel, samples, overhead, hist);
+        printf("  \033[1;36m%-10s %9.1f %9.1f %9.1f %9.1f %9.1f\033[0m\n", latency_cases[c].name,
+               (double)hdr_percentile(hist, 0.50) / ticks_per_ns,
+               (double)hdr_percentile(hist, 0.90) / ticks_per_ns,
+               (double)hdr_percentile(hist, 0.99) / ticks_per_ns,
+               (double)hdr_percentile(hist, 0.999) / ticks_per_ns,
+               (double)hist->max / ticks_per_ns);
+        fflush(stdout);
+    }
+    free(hist);
+}
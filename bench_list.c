@@ -0,0 +1,418 @@
+#include "test_libft.h"
+
+// Large-list scaling for the t_list API. Enabled with BENCH_LIST=1. Lists of
+// 10^3 up to BENCH_LIST_MAX nodes (default 10^7) are built, traversed, mapped
+// and cleared, and each phase is reported in ns per node. Nodes point at one
+// shared payload, so only the list itself is allocated. Building through
+// ft_lstadd_back walks the whole list for every node, as does an ft_lstmap
+// built on it; a phase is skipped once the growth seen so far predicts one
+// pass over LIST_PHASE_BUDGET_NS
+#define LIST_DEFAULT_MAX 10000000
+#define LIST_MIN_SIZE 1000
+#define LIST_NODES_PER_SIZE 1000000     // repetitions shrink as lists grow
+#define LIST_MAX_REPS 1001
+#define LIST_PHASE_BUDGET_NS 10e9       // longest single pass attempted
+#define LIST_REPEAT_BUDGET_NS 3e9       // repetitions stop after this much
+
+typedef enum e_list_phase {
+    LIST_ADD_FRONT,
+    LIST_ADD_BACK,
+    LIST_SIZE,
+    LIST_ITER,
+    LIST_MAP,
+    LIST_CLEAR,
+    LIST_PHASE_COUNT
+} e_list_phase;
+
+static const char *list_phase_names[LIST_PHASE_COUNT] = {
+    "add_front", "add_back", "lstsize", "lstiter", "lstmap", "lstclear"
+};
+
+static int list_payload;
+static t_list *list_head;
+static t_list *list_mapped;
+static size_t list_n;
+static int list_failed;
+
+static void list_noop_del(void *content) {
+    (void)content;
+}
+
+static void list_touch(void *content) {
+    BENCH_KEEP(content);
+}
+
+static void *list_identity(void *content) {
+    return content;
+}
+
+// Helper function to free a list without timing, whatever lstclear does
+static void list_release(t_list **lst) {
+    while (*lst) {
+        t_list *next = (*lst)->next;
+        free(*lst);
+        *lst = next;
+    }
+}
+
+static void list_build_front(void) {
+    for (size_t i = 0; i < list_n; i++) {
+        t_list *node = ft_lstnew(&list_payload);
+
+        if (!node) {
+            list_failed = 1;
+            return;
+        }
+        ft_lstadd_front(&list_head, node);
+    }
+}
+
+static void list_build_back(void) {
+    for (size_t i = 0; i < list_n; i++) {
+        t_list *node = ft_lstnew(&list_payload);
+
+        if (!node) {
+            list_failed = 1;
+            return;
+        }
+        ft_lstadd_back(&list_head, node);
+    }
+}
+
+static void list_size(void) {
+    BENCH_KEEP(ft_lstsize(list_head));
+}
+
+static void list_iter(void) {
+    ft_lstiter(list_head, list_touch);
+}
+
+static void list_map(void) {
+    list_mapped = ft_lstmap(list_head, list_identity, list_noop_del);
+    if (!list_mapped)
+        list_failed = 1;
+}
+
+static void list_clear(void) {
+    ft_lstclear(&list_head, list_noop_del);
+}
+
+// Helper function to take the median of count per-node samples
+static double list_median(double *samples, size_t count) {
+    t_bench_stats stats;
+
+    bench_compute_stats(samples, count, &stats);
+    return stats.median_ns;
+}
+
+// Timing history of one phase, used to predict the next size
+typedef struct s_list_history {
+    size_t last_n;
+    double last_ns;     // time of one pass at last_n
+    size_t prev_n;
+    double prev_ns;
+} t_list_history;
+
+// Helper function to predict one pass at size n from the growth seen between
+// the last two sizes (at least linear)
+static double list_predict(const t_list_history *history, size_t n) {
+    double exponent = 1.0;
+
+    if (!history->last_n)
+        return 0.0;
+    if (history->prev_n && history->prev_ns > 0 && history->last_ns > history->prev_ns)
+        exponent = log(history->last_ns / history->prev_ns)
+                 / log((double)history->last_n / (double)history->prev_n);
+    if (exponent < 1.0)
+        exponent = 1.0;
+    return history->last_ns * pow((double)n / (double)history->last_n, exponent);
+}
+
+// Helper function to time the enabled phases up to reps times at size n into
+// per_node (ns per node, median over the passes run). Passes stop early once
+// they add up to LIST_REPEAT_BUDGET_NS. The list built by add_front feeds the
+// traversals, so it always runs. Returns -1 when an allocation fails
+static int list_measure(size_t n, size_t reps, const int enabled[LIST_PHASE_COUNT],
+                        double per_node[LIST_PHASE_COUNT]) {
+    static double samples[LIST_PHASE_COUNT][LIST_MAX_REPS];
+    static void (*const kernels[LIST_PHASE_COUNT])(void) = {
+        list_build_front, list_build_back, list_size, list_iter, list_map, list_clear
+    };
+
+    double spent = 0.0;
+    size_t done = 0;
+
+    list_n = n;
+    list_failed = 0;
+    while (done < reps && spent < LIST_REPEAT_BUDGET_NS && !list_failed) {
+        for (int p = 0; p < LIST_PHASE_COUNT && !list_failed; p++) {
+            if (p == LIST_ADD_BACK || !enabled[p])
+                continue;
+            samples[p][done] = measure_time_ns(kernels[p], 1) / (double)n;
+            spent += samples[p][done] * (double)n;
+            list_release(&list_mapped);
+        }
+        list_release(&list_head);
+        if (enabled[LIST_ADD_BACK] && !list_failed) {
+            samples[LIST_ADD_BACK][done] = measure_time_ns(list_build_back, 1) / (double)n;
+            spent += samples[LIST_ADD_BACK][done] * (double)n;
+            list_release(&list_head);
+        }
+        done++;
+    }
+    if (list_failed) {
+        list_release(&list_mapped);
+        list_release(&list_head);
+        return -1;
+    }
+    for (int p = 0; p < LIST_PHASE_COUNT; p++)
+        per_node[p] = enabled[p] ? list_median(samples[p], done) : -1.0;
+    return 0;
+}
+
+void run_list_scaling(void) {
+    size_t max_size = bench_env_size("BENCH_LIST_MAX", LIST_DEFAULT_MAX);
+    t_list_history history[LIST_PHASE_COUNT] = {{0}};
+    int skipped = 0;
+
+    printf("  \033[1m%10s", "nodes");
+    for (int p = 0; p < LIST_PHASE_COUNT; p++)
+        printf(" %10s", list_phase_names[p]);
+    printf("   (ns per node, median)\033[0m\n");
+    for (size_t n = LIST_MIN_SIZE; n <= max_size; n *= 10) {
+        double per_node[LIST_PHASE_COUNT];
+        double predicted[LIST_PHASE_COUNT];
+        int enabled[LIST_PHASE_COUNT];
+        size_t reps = LIST_NODES_PER_SIZE / n;
+
+        for (int p = 0; p < LIST_PHASE_COUNT; p++) {
+            predicted[p] = list_predict(&history[p], n);
+            enabled[p] = predicted[p] <= LIST_PHASE_BUDGET_NS;
+        }
+        if (!enabled[LIST_ADD_FRONT])
+            break;
+        if (reps < 1)
+            reps = 1;
+        if (reps > LIST_MAX_REPS)
+            reps = LIST_MAX_REPS;
+        if (list_measure(n, reps, enabled, per_node) != 0) {
+            printf("  \033[1;31m%10zu allocation failed; stopping\033[0m\n", n);
+            break;
+        }
+        printf("  %10zu", n);
+        for (int p = 0; p < LIST_PHASE_COUNT; p++) {
+            if (!enabled[p]) {
+                printf(" %9.3gs", predicted[p] / 1e9);
+                skipped = 1;
+                continue;
+            }
+            printf(" %10.2f", per_node[p]);
+            history[p].prev_n = history[p].last_n;
+            history[p].prev_ns = history[p].last_ns;
+            history[p].last_n = n;
+            history[p].last_ns = per_node[p] * (double)n;
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+    if (skipped)
+        printf("  Cells in seconds were skipped and show the predicted time of one pass\n");
+}
+
+// Traversal cost by node placement. Enabled with BENCH_LIST_LOCALITY=1.
+// BENCH_LOCALITY_NODES nodes (default 10^6, past most last-level caches) are
+// allocated with ft_lstnew and linked sequential (list order = allocation
+// order), shuffled (random order across the heap) or interleaved (a
+// long-lived allocation of random size between consecutive nodes, as in a
+// fragmented heap). Each traversal is reported in ns and LLC misses per node
+#define LOCALITY_DEFAULT_NODES 1000000
+#define LOCALITY_ITERATIONS 11
+#define LOCALITY_MIN_ITERATIONS 3
+#define LOCALITY_PROBE_SMALL 1000
+#define LOCALITY_PROBE_LARGE 10000
+#define LOCALITY_FILLER_MIN 16
+#define LOCALITY_FILLER_SPREAD 241     // fillers are 16..256 bytes
+
+typedef enum e_locality_mode {
+    LOCALITY_SEQUENTIAL,
+    LOCALITY_SHUFFLED,
+    LOCALITY_INTERLEAVED,
+    LOCALITY_MODE_COUNT
+} e_locality_mode;
+
+static const char *locality_mode_names[LOCALITY_MODE_COUNT] = {
+    "sequential", "shuffled", "interleaved"
+};
+
+static void list_last(void) {
+    BENCH_KEEP(ft_lstlast(list_head));
+}
+
+static void list_map_release(void) {
+    list_map();
+    list_release(&list_mapped);
+}
+
+typedef struct s_locality_case {
+    const char *name;
+    void (*kernel)(void);
+} t_locality_case;
+
+static const t_locality_case locality_cases[] = {
+    {"lstiter", list_iter},
+    {"lstsize", list_size},
+    {"lstlast", list_last},
+    {"lstmap", list_map_release},
+};
+
+#define LOCALITY_CASE_COUNT (sizeof(locality_cases) / sizeof(*locality_cases))
+
+static t_list **locality_nodes;     // allocation order
+static void **locality_fillers;
+
+// Helper function to free the fillers of interleaved mode
+static void locality_free_fillers(size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        free(locality_fillers[i]);
+        locality_fillers[i] = NULL;
+    }
+}
+
+// Helper function to allocate n nodes for mode and link them into list_head
+static int locality_build(e_locality_mode mode, size_t n) {
+    uint32_t state = 0x9E3779B9u;
+
+    for (size_t i = 0; i < n; i++) {
+        state = state * 1664525u + 1013904223u;
+        if (mode == LOCALITY_INTERLEAVED)
+            locality_fillers[i] = malloc(LOCALITY_FILLER_MIN + (state >> 8) % LOCALITY_FILLER_SPREAD);
+        locality_nodes[i] = ft_lstnew(&list_payload);
+        if (!locality_nodes[i]) {
+            while (i-- > 0)
+                free(locality_nodes[i]);
+            locality_free_fillers(n);
+            return -1;
+        }
+    }
+    if (mode == LOCALITY_SHUFFLED) {
+        for (size_t i = n - 1; i > 0; i--) {
+            size_t j;
+            t_list *swap;
+
+            state = state * 1664525u + 1013904223u;
+            j = (size_t)(((uint64_t)state * (i + 1)) >> 32);
+            swap = locality_nodes[i];
+            locality_nodes[i] = locality_nodes[j];
+            locality_nodes[j] = swap;
+        }
+    }
+    list_head = NULL;
+    for (size_t i = n; i > 0; i--)
+        ft_lstadd_front(&list_head, locality_nodes[i - 1]);
+    return 0;
+}
+
+// Helper function to time one call of kernel on the first k nodes only
+static double locality_time_prefix(void (*kernel)(void), size_t k) {
+    t_list *cut = list_head;
+    t_list *rest;
+    double ns;
+
+    for (size_t i = 1; i < k && cut->next; i++)
+        cut = cut->next;
+    rest = cut->next;
+    cut->next = NULL;
+    ns = measure_time_ns(kernel, 1);
+    cut->next = rest;
+    return ns;
+}
+
+// Helper function to time one case on the current list. A probe on 10^3- and
+// 10^4-node prefixes predicts the full call, so a quadratic ft_lstmap is
+// skipped (returns -1, predicted set) instead of running for hours
+static int locality_measure(const t_locality_case *entry, size_t n, double *ns,
+                            double *llc, double *predicted) {
+    t_list_history history = {0};
+    t_bench_config config = bench_default_config();
+    t_bench_stats stats;
+    t_bench_counters counters;
+    size_t affordable;
+
+    history.prev_n = LOCALITY_PROBE_SMALL;
+    history.prev_ns = locality_time_prefix(entry->kernel, LOCALITY_PROBE_SMALL);
+    history.last_n = LOCALITY_PROBE_LARGE;
+    history.last_ns = locality_time_prefix(entry->kernel, LOCALITY_PROBE_LARGE);
+    *predicted = n > LOCALITY_PROBE_LARGE ? list_predict(&history, n) : history.last_ns;
+    if (list_failed || *predicted > LIST_PHASE_BUDGET_NS)
+        return -1;
+    affordable = (size_t)(LIST_REPEAT_BUDGET_NS / (*predicted > 1.0 ? *predicted : 1.0));
+    config.warmup = 1;
+    if (config.iterations > LOCALITY_ITERATIONS)
+        config.iterations = LOCALITY_ITERATIONS;
+    if (config.iterations > affordable)
+        config.iterations = affordable < LOCALITY_MIN_ITERATIONS ? LOCALITY_MIN_ITERATIONS : affordable;
+    if (run_benchmark_counted(entry->kernel, &config, &stats, &counters) != 0 || list_failed)
+        return -1;
+    *ns = stats.median_ns / (double)n;
+    *llc = counters.valid && counters.have[COUNTER_LLC_MISSES]
+         ? counters.per_call[COUNTER_LLC_MISSES] / (double)n : -1.0;
+    return 0;
+}
+
+void run_list_locality(void) {
+    size_t n = bench_env_size("BENCH_LOCALITY_NODES", LOCALITY_DEFAULT_NODES);
+    double iter_ns[LOCALITY_MODE_COUNT] = {0};
+
+    if (n < LOCALITY_PROBE_LARGE)
+        n = LOCALITY_PROBE_LARGE;
+    locality_nodes = malloc(n * sizeof(*locality_nodes));
+    locality_fillers = calloc(n, sizeof(*locality_fillers));
+    if (!locality_nodes || !locality_fillers) {
+        printf("  \033[1;31mList locality skipped: allocation failed\033[0m\n");
+        free(locality_nodes);
+        free(locality_fillers);
+        return;
+    }
+    printf("  \033[1m%-12s", "");
+    for (size_t c = 0; c < LOCALITY_CASE_COUNT; c++)
+        printf(" %17s", locality_cases[c].name);
+    printf("\033[0m\n  \033[1m%-12s", "placement");
+    for (size_t c = 0; c < LOCALITY_CASE_COUNT; c++)
+        printf(" %9s %7s", "ns/node", "LLC/nd");
+    printf("\033[0m   (%zu nodes)\n", n);
+    for (int mode = 0; mode < LOCALITY_MODE_COUNT; mode++) {
+        list_failed = 0;
+        if (locality_build((e_locality_mode)mode, n) != 0) {
+            printf("  \033[1;31m%-12s allocation failed\033[0m\n", locality_mode_names[mode]);
+            continue;
+        }
+        printf("  %-12s", locality_mode_names[mode]);
+        for (size_t c = 0; c < LOCALITY_CASE_COUNT; c++) {
+            double ns;
+            double llc;
+            double predicted;
+
+            if (locality_measure(&locality_cases[c], n, &ns, &llc, &predicted) != 0) {
+                printf(" %16.3gs", predicted / 1e9);
+                continue;
+            }
+            if (c == 0)
+                iter_ns[mode] = ns;
+            if (llc >= 0)
+                printf(" %9.2f %7.3f", ns, llc);
+            else
+                printf(" %9.2f %7s", ns, "n/a");
+        }
+        printf("\n");
+        fflush(stdout);
+        list_release(&list_head);
+        locality_free_fillers(n);
+    }
+    free(locality_nodes);
+    free(locality_fillers);
+    locality_nodes = NULL;
+    locality_fillers = NULL;
+    if (iter_ns[LOCALITY_SEQUENTIAL] > 0 && iter_ns[LOCALITY_SHUFFLED] > 0)
+        printf("  Shuffled traversal is %.1fx slower than sequential\n",
+               iter_ns[LOCALITY_SHUFFLED] / iter_ns[LOCALITY_SEQUENTIAL]);
+}
@@ -0,0 +1,29 @@
+#include "../../Libft/libft.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <limits.h>
+
+// libFuzzer entry point for ft_atoi. The input is copied into an exactly
+// sized heap buffer so AddressSanitizer catches any read past the
+// terminator, and the result is cross-checked against strtol wherever the
+// value fits in an int (overflow is undefined for atoi, so it is skipped)
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    char *str = malloc(size + 1);
+    long expected;
+    int result;
+
+    if (!str)
+        return 0;
+    memcpy(str, data, size);
+    str[size] = '\0';
+    result = ft_atoi(str);
+    expected = strtol(str, NULL, 10);
+    if (expected >= INT_MIN && expected <= INT_MAX && result != (int)expected) {
+        fprintf(stderr, "ft_atoi(\"%s\") = %d, strtol gives %ld\n", str, result, expected);
+        abort();
+    }
+    free(str);
+    return 0;
+}
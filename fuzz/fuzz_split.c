@@ -0,0 +1,54 @@
+#include "../../Libft/libft.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+// libFuzzer entry point for ft_split. The first byte is the delimiter and
+// the rest, up to the first NUL, is the string. Every piece must be
+// non-empty, free of the delimiter and match the next run of non-delimiter
+// characters of the input
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    char delimiter;
+    char *str;
+    char **parts;
+    size_t pos = 0;
+    size_t count = 0;
+
+    if (size < 1)
+        return 0;
+    delimiter = (char)data[0];
+    str = malloc(size);
+    if (!str)
+        return 0;
+    memcpy(str, data + 1, size - 1);
+    str[size - 1] = '\0';
+    parts = ft_split(str, delimiter);
+    if (!parts) {
+        fprintf(stderr, "ft_split returned NULL\n");
+        abort();
+    }
+    for (; parts[count]; count++) {
+        size_t len;
+
+        while (str[pos] && str[pos] == delimiter)
+            pos++;
+        len = strcspn(str + pos, (char[]){delimiter, '\0'});
+        if (len == 0 || strlen(parts[count]) != len || memcmp(parts[count], str + pos, len) != 0) {
+            fprintf(stderr, "ft_split piece %zu is \"%s\", expected \"%.*s\"\n",
+                    count, parts[count], (int)len, str + pos);
+            abort();
+        }
+        pos += len;
+        free(parts[count]);
+    }
+    while (str[pos] && str[pos] == delimiter)
+        pos++;
+    if (str[pos]) {
+        fprintf(stderr, "ft_split stopped after %zu pieces at offset %zu\n", count, pos);
+        abort();
+    }
+    free(parts);
+    free(str);
+    return 0;
+}
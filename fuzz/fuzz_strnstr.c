@@ -0,0 +1,61 @@
+#include "../../Libft/libft.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+// libFuzzer entry point for ft_strnstr. The first two bytes are len
+// (little-endian, 0xffff meaning SIZE_MAX); the rest is the haystack and the
+// needle separated by the first NUL. Both are copied into exactly sized
+// heap buffers for AddressSanitizer. The reference is memmem over the
+// searched prefix, which is linear, so run with -timeout to surface
+// implementations that are quadratic on inputs like "aaa...ab"
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    const uint8_t *split;
+    size_t hay_len;
+    size_t needle_len;
+    size_t len;
+    size_t limit;
+    char *haystack;
+    char *needle;
+    char *result;
+    char *expected;
+
+    if (size < 2)
+        return 0;
+    len = (size_t)data[0] | (size_t)data[1] << 8;
+    if (len == 0xffff)
+        len = SIZE_MAX;
+    data += 2;
+    size -= 2;
+    split = memchr(data, '\0', size);
+    hay_len = split ? (size_t)(split - data) : size;
+    needle_len = split ? size - hay_len - 1 : 0;
+    haystack = malloc(hay_len + 1);
+    needle = malloc(needle_len + 1);
+    if (!haystack || !needle) {
+        free(haystack);
+        free(needle);
+        return 0;
+    }
+    memcpy(haystack, data, hay_len);
+    haystack[hay_len] = '\0';
+    memcpy(needle, data + hay_len + (split != NULL), needle_len);
+    needle[needle_len] = '\0';
+    needle_len = strlen(needle);
+
+    limit = len < hay_len ? len : hay_len;
+    if (needle_len == 0)
+        expected = haystack;
+    else
+        expected = memmem(haystack, limit, needle, needle_len);
+    result = ft_strnstr(haystack, needle, len);
+    if (result != expected) {
+        fprintf(stderr, "ft_strnstr(\"%s\", \"%s\", %zu) at %td, expected %td\n", haystack, needle, len,
+                result ? result - haystack : -1, expected ? expected - haystack : -1);
+        abort();
+    }
+    free(haystack);
+    free(needle);
+    return 0;
+}
@@ -0,0 +1,358 @@
+#include "test_libft.h"
+
+const char test_alloc_file[] = __FILE__;
+
+// Allocation profiler. When linked with -Wl,--wrap=malloc,--wrap=calloc,
+// --wrap=realloc,--wrap=free (the Makefile does this on Linux and defines
+// ALLOC_TRACE),
+// every allocation made by libft or the tests passes through the wrappers
+// below and is counted while a trace scope is open. Allocations made in a
+// scope are also kept in a live table until freed, so whatever is still
+// live at tearDown() is a leak attributable to that test
+#define ALLOC_LIVE_CAPACITY (1 << 16)
+#define ALLOC_MAX_REPORTED_SITES 8
+
+static t_alloc_profile alloc_scope;
+static int alloc_tracing;
+static pthread_t alloc_trace_thread;    // only this thread's calls are traced
+t_alloc_test_profile alloc_test_profiles[ALLOC_MAX_TESTS];
+size_t alloc_test_count;
+
+typedef struct s_alloc_live {
+    void *ptr;          // NULL marks an empty slot
+    size_t size;
+    void *site;         // return address of the malloc/calloc/realloc call
+} t_alloc_live;
+
+// Open-addressing table (linear probing, backward-shift deletion) of blocks
+// allocated inside the current scope and not yet freed
+static t_alloc_live alloc_live[ALLOC_LIVE_CAPACITY];
+static size_t alloc_live_count;
+static int alloc_live_overflow;
+#ifdef ALLOC_TRACE
+size_t leak_total_bytes;
+size_t leak_total_blocks;
+size_t leak_tests;
+#endif
+
+static void alloc_live_clear(void) {
+    if (alloc_live_count)
+        memset(alloc_live, 0, sizeof(alloc_live));
+    alloc_live_count = 0;
+    alloc_live_overflow = 0;
+}
+
+#ifdef ALLOC_TRACE
+static size_t alloc_live_slot(const void *ptr) {
+    uintptr_t h = (uintptr_t)ptr >> 4;
+
+    h ^= h >> 17;
+    h *= 0xed5ad4bbU;
+    h ^= h >> 11;
+    return (size_t)h & (ALLOC_LIVE_CAPACITY - 1);
+}
+
+static void alloc_live_insert(void *ptr, size_t size, void *site) {
+    size_t i;
+
+    // Keep the table under 3/4 full so probes stay short
+    if (alloc_live_count >= ALLOC_LIVE_CAPACITY / 4 * 3) {
+        alloc_live_overflow = 1;
+        return;
+    }
+    i = alloc_live_slot(ptr);
+    while (alloc_live[i].ptr)
+        i = (i + 1) & (ALLOC_LIVE_CAPACITY - 1);
+    alloc_live[i].ptr = ptr;
+    alloc_live[i].size = size;
+    alloc_live[i].site = site;
+    alloc_live_count++;
+}
+
+// Remove ptr if it is tracked; returns 1 when it was
+static int alloc_live_remove(const void *ptr) {
+    size_t i = alloc_live_slot(ptr);
+    size_t j;
+
+    while (alloc_live[i].ptr && alloc_live[i].ptr != ptr)
+        i = (i + 1) & (ALLOC_LIVE_CAPACITY - 1);
+    if (!alloc_live[i].ptr)
+        return 0;
+    // Shift later entries of the probe run back into the hole
+    j = i;
+    for (;;) {
+        size_t home;
+
+        j = (j + 1) & (ALLOC_LIVE_CAPACITY - 1);
+        if (!alloc_live[j].ptr)
+            break;
+        home = alloc_live_slot(alloc_live[j].ptr);
+        if (((j - home) & (ALLOC_LIVE_CAPACITY - 1)) >= ((j - i) & (ALLOC_LIVE_CAPACITY - 1))) {
+            alloc_live[i] = alloc_live[j];
+            i = j;
+        }
+    }
+    alloc_live[i].ptr = NULL;
+    alloc_live_count--;
+    return 1;
+}
+
+// Helper function to map a request size to its histogram class
+static int alloc_size_class(size_t size) {
+    int cls = 0;
+    size_t limit = 16;
+
+    while (cls < ALLOC_CLASSES - 1 && size > limit) {
+        limit *= 2;
+        cls++;
+    }
+    return cls;
+}
+
+static void alloc_trace_record(void *ptr, size_t size, void *site) {
+    if (!alloc_tracing || !ptr || !pthread_equal(pthread_self(), alloc_trace_thread))
+        return;
+    alloc_scope.allocations++;
+    alloc_scope.bytes += size;
+    alloc_scope.histogram[alloc_size_class(size)]++;
+    alloc_live_insert(ptr, size, site);
+}
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_malloc(size_t size) {
+    void *ptr = __real_malloc(size);
+    alloc_trace_record(ptr, size, __builtin_return_address(0));
+    return ptr;
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    void *ptr = __real_calloc(count, size);
+    alloc_trace_record(ptr, count * size, __builtin_return_address(0));
+    return ptr;
+}
+
+// A traced block that is resized counts as freed, and the result as a new
+// allocation at the realloc call. Resizing a block from outside the scope is
+// not traced, as with free, and a failed realloc leaves the old block live
+void *__wrap_realloc(void *old, size_t size) {
+    void *ptr = __real_realloc(old, size);
+
+    if (!alloc_tracing || !pthread_equal(pthread_self(), alloc_trace_thread))
+        return ptr;
+    if (old && (ptr || size == 0)) {
+        if (!alloc_live_remove(old))
+            return ptr;
+        alloc_scope.frees++;
+    }
+    alloc_trace_record(ptr, size, __builtin_return_address(0));
+    return ptr;
+}
+
+// Only frees of blocks allocated inside the scope are counted, so memory
+// from untraced sources (libc strdup, earlier setup) does not skew totals.
+// Worker threads started by a test are not traced: the live table has no lock
+void __wrap_free(void *ptr) {
+    if (alloc_tracing && ptr && pthread_equal(pthread_self(), alloc_trace_thread)
+        && alloc_live_remove(ptr))
+        alloc_scope.frees++;
+    __real_free(ptr);
+}
+
+// Helper function to print an allocation site as symbol+offset when possible
+static void print_alloc_site(void *site) {
+    Dl_info info;
+
+    if (dladdr(site, &info) && info.dli_sname)
+        printf("%s+0x%lx", info.dli_sname, (unsigned long)((char *)site - (char *)info.dli_saddr));
+    else
+        printf("%p", site);
+}
+
+// Report blocks still live at the end of a test, grouped by allocation site.
+// Returns the number of leaked bytes
+static size_t alloc_report_leaks(const char *test_name) {
+    void *sites[ALLOC_MAX_REPORTED_SITES];
+    size_t site_bytes[ALLOC_MAX_REPORTED_SITES];
+    size_t site_blocks[ALLOC_MAX_REPORTED_SITES];
+    size_t nsites = 0;
+    size_t bytes = 0;
+
+    if (!alloc_live_count)
+        return 0;
+    for (size_t i = 0; i < ALLOC_LIVE_CAPACITY; i++) {
+        size_t k = 0;
+
+        if (!alloc_live[i].ptr)
+            continue;
+        bytes += alloc_live[i].size;
+        while (k < nsites && sites[k] != alloc_live[i].site)
+            k++;
+        if (k == nsites && nsites < ALLOC_MAX_REPORTED_SITES) {
+            sites[k] = alloc_live[i].site;
+            site_bytes[k] = 0;
+            site_blocks[k] = 0;
+            nsites++;
+        }
+        if (k < nsites) {
+            site_bytes[k] += alloc_live[i].size;
+            site_blocks[k]++;
+        }
+    }
+    printf("\n  \033[1;31mLeak in %s: %zu bytes in %zu block(s)\033[0m\n", test_name, bytes, alloc_live_count);
+    for (size_t k = 0; k < nsites; k++) {
+        printf("    %zu bytes in %zu block(s) allocated at ", site_bytes[k], site_blocks[k]);
+        print_alloc_site(sites[k]);
+        printf("\n");
+    }
+    leak_total_bytes += bytes;
+    leak_total_blocks += alloc_live_count;
+    leak_tests++;
+    return bytes;
+}
+#endif
+
+// Start counting allocations from zero
+void alloc_trace_begin(void) {
+    memset(&alloc_scope, 0, sizeof(alloc_scope));
+    alloc_live_clear();
+    alloc_trace_thread = pthread_self();
+    alloc_tracing = 1;
+}
+
+// Stop counting and copy the scope's totals to out
+void alloc_trace_end(t_alloc_profile *out) {
+    alloc_tracing = 0;
+    *out = alloc_scope;
+}
+
+// Helper function to print a profile's totals and non-empty size classes
+void print_alloc_profile(const t_alloc_profile *profile) {
+    static const char *labels[ALLOC_CLASSES] = {
+        "<=16", "<=32", "<=64", "<=128", "<=256", "<=512", "<=1K", "<=2K", "<=4K", ">4K"
+    };
+
+    printf("allocs %zu, frees %zu, %zu B  [", profile->allocations, profile->frees, profile->bytes);
+    for (int i = 0, first = 1; i < ALLOC_CLASSES; i++) {
+        if (profile->histogram[i]) {
+            printf("%s%s:%zu", first ? "" : " ", labels[i], profile->histogram[i]);
+            first = 0;
+        }
+    }
+    printf("]\n");
+}
+
+// Print the allocation profile of every test that allocated
+void print_test_alloc_profiles(void) {
+#ifndef ALLOC_TRACE
+    printf("  Allocation tracing unavailable on this platform (needs ld --wrap)\n");
+#endif
+    for (size_t i = 0; i < alloc_test_count; i++) {
+        if (alloc_test_profiles[i].profile.allocations == 0)
+            continue;
+        printf("  %-24s ", alloc_test_profiles[i].name);
+        print_alloc_profile(&alloc_test_profiles[i].profile);
+    }
+}
+
+// Every test runs inside an allocation trace scope; a test that passes its
+// assertions but leaves blocks allocated fails with the leak sites
+void setUp(void) {
+    alloc_trace_begin();
+}
+
+void tearDown(void) {
+    t_alloc_profile profile;
+
+    alloc_trace_end(&profile);
+    if (alloc_test_count < ALLOC_MAX_TESTS) {
+        alloc_test_profiles[alloc_test_count].name = Unity.CurrentTestName;
+        alloc_test_profiles[alloc_test_count].profile = profile;
+        alloc_test_count++;
+    }
+#ifdef ALLOC_TRACE
+    // A failed assertion skips the test's own cleanup, so only judge leaks
+    // for tests that otherwise passed
+    if (!Unity.CurrentTestFailed && alloc_report_leaks(Unity.CurrentTestName) > 0) {
+        alloc_live_clear();
+        UNITY_TEST_FAIL(Unity.CurrentTestLineNumber, "memory leaked during test");
+    }
+    if (alloc_live_overflow)
+        printf("\n  \033[0;33m%s: live-allocation table full, leak check incomplete\033[0m\n",
+               Unity.CurrentTestName);
+    alloc_live_clear();
+#endif
+}
+
+// Helper function to check for memory leaks
+void check_memory_leaks(void) {
+    printf("Starting memory leak check...\n");
+    #ifdef ALLOC_TRACE
+        // Per-test accounting already ran in tearDown(); summarize it
+        if (leak_tests) {
+            printf("Memory leaks detected: %zu bytes in %zu block(s) across %zu test(s)\n",
+                   leak_total_bytes, leak_total_blocks, leak_tests);
+        } else {
+            printf("No memory leaks detected.\n");
+        }
+    #elif defined(SANITIZER_LEAK_CHECK)
+        // make asan / make lsan: LeakSanitizer checks the whole process at exit
+        printf("Leaks are reported by LeakSanitizer when the process exits.\n");
+    #elif defined(__APPLE__)
+        printf("Running leaks command...\n");
+        // Wait a moment to ensure all memory is freed
+        usleep(100000);  // 100ms delay
+        int result = system("leaks test_libft_bonus > /dev/null");
+        if (result != 0) {
+            printf("Memory leaks detected!\n");
+        } else {
+            printf("No memory leaks detected.\n");
+        }
+    #else
+        // e.g. make ubsan on Linux: no tracer, no LeakSanitizer, no leaks(1)
+        printf("\033[0;33mLeak check unavailable in this build; nothing was checked.\033[0m\n");
+    #endif
+    printf("Memory leak check completed.\n");
+}
+
+void test_calloc(void) {
+    int *arr = ft_calloc(5, sizeof(int));
+    TEST_ASSERT_NOT_NULL(arr);
+    for (int i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL(0, arr[i]);
+    }
+    free(arr);
+    
+    // Test with zero
+    void *ptr = ft_calloc(0, 5);
+    if (ptr) {
+        free(ptr);
+    }
+    ptr = ft_calloc(5, 0);
+    if (ptr) {
+        free(ptr);
+    }
+    
+    // Test with overflow
+    TEST_ASSERT_NULL(ft_calloc(SIZE_MAX, SIZE_MAX));
+}
+
+void test_strdup(void) {
+    char *str1 = ft_strdup("Hello");
+    TEST_ASSERT_NOT_NULL(str1);
+    TEST_ASSERT_EQUAL_STRING("Hello", str1);
+    free(str1);
+
+    char *str2 = ft_strdup("");
+    TEST_ASSERT_NOT_NULL(str2);
+    TEST_ASSERT_EQUAL_STRING("", str2);
+    free(str2);
+
+    char *str3 = ft_strdup("AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA");
+    TEST_ASSERT_NOT_NULL(str3);
+    TEST_ASSERT_EQUAL_STRING("AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA", str3);
+    free(str3);
+}
@@ -0,0 +1,136 @@
+#include "test_libft.h"
+
+const char test_ctype_file[] = __FILE__;
+
+// Character functions tests
+void test_isalpha(void) {
+    TEST_ASSERT_EQUAL(1, ft_isalpha('a'));
+    TEST_ASSERT_EQUAL(1, ft_isalpha('Z'));
+    TEST_ASSERT_EQUAL(0, ft_isalpha('1'));
+    TEST_ASSERT_EQUAL(0, ft_isalpha('@'));
+    TEST_ASSERT_EQUAL(0, ft_isalpha('\0'));
+    TEST_ASSERT_EQUAL(0, ft_isalpha(-1));
+    TEST_ASSERT_EQUAL(0, ft_isalpha(128));
+}
+
+void test_isdigit(void) {
+    TEST_ASSERT_EQUAL(1, ft_isdigit('0'));
+    TEST_ASSERT_EQUAL(1, ft_isdigit('9'));
+    TEST_ASSERT_EQUAL(0, ft_isdigit('a'));
+    TEST_ASSERT_EQUAL(0, ft_isdigit('@'));
+    TEST_ASSERT_EQUAL(0, ft_isdigit('\0'));
+    TEST_ASSERT_EQUAL(0, ft_isdigit(-1));
+    TEST_ASSERT_EQUAL(0, ft_isdigit(128));
+}
+
+void test_isalnum(void) {
+    TEST_ASSERT_EQUAL(1, ft_isalnum('a'));
+    TEST_ASSERT_EQUAL(1, ft_isalnum('Z'));
+    TEST_ASSERT_EQUAL(1, ft_isalnum('0'));
+    TEST_ASSERT_EQUAL(0, ft_isalnum('@'));
+    TEST_ASSERT_EQUAL(0, ft_isalnum('\0'));
+    TEST_ASSERT_EQUAL(0, ft_isalnum(-1));
+    TEST_ASSERT_EQUAL(0, ft_isalnum(128));
+}
+
+void test_isascii(void) {
+    TEST_ASSERT_EQUAL(1, ft_isascii(0));
+    TEST_ASSERT_EQUAL(1, ft_isascii(127));
+    TEST_ASSERT_EQUAL(0, ft_isascii(128));
+    TEST_ASSERT_EQUAL(0, ft_isascii(-1));
+}
+
+void test_isprint(void) {
+    TEST_ASSERT_EQUAL(1, ft_isprint(' '));
+    TEST_ASSERT_EQUAL(1, ft_isprint('~'));
+    TEST_ASSERT_EQUAL(0, ft_isprint('\t'));
+    TEST_ASSERT_EQUAL(0, ft_isprint('\0'));
+    TEST_ASSERT_EQUAL(0, ft_isprint(128));
+}
+
+void test_toupper(void) {
+    TEST_ASSERT_EQUAL('A', ft_toupper('a'));
+    TEST_ASSERT_EQUAL('Z', ft_toupper('z'));
+    TEST_ASSERT_EQUAL('A', ft_toupper('A'));
+    TEST_ASSERT_EQUAL('1', ft_toupper('1'));
+    TEST_ASSERT_EQUAL('@', ft_toupper('@'));
+}
+
+void test_tolower(void) {
+    TEST_ASSERT_EQUAL('a', ft_tolower('A'));
+    TEST_ASSERT_EQUAL('z', ft_tolower('Z'));
+    TEST_ASSERT_EQUAL('a', ft_tolower('a'));
+    TEST_ASSERT_EQUAL('1', ft_tolower('1'));
+    TEST_ASSERT_EQUAL('@', ft_tolower('@'));
+}
+
+// Reference classification table generated by the preprocessor: one flag
+// byte per unsigned char value, C locale. Used by the exhaustive ctype test
+// and as the branch-free baseline in the lookup-table benchmarks
+#define CTYPE_FLAGS(c) \
+    ((((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z')) * CTYPE_ALPHA \
+     | ((c) >= '0' && (c) <= '9') * CTYPE_DIGIT \
+     | ((c) >= ' ' && (c) <= '~') * CTYPE_PRINT)
+#define CTYPE_UPPER(c) ((c) >= 'a' && (c) <= 'z' ? (c) - 'a' + 'A' : (c))
+#define CTYPE_ROW4(f, c) f(c), f((c) + 1), f((c) + 2), f((c) + 3)
+#define CTYPE_ROW16(f, c) CTYPE_ROW4(f, c), CTYPE_ROW4(f, (c) + 4), CTYPE_ROW4(f, (c) + 8), CTYPE_ROW4(f, (c) + 12)
+#define CTYPE_ROW64(f, c) CTYPE_ROW16(f, c), CTYPE_ROW16(f, (c) + 16), CTYPE_ROW16(f, (c) + 32), CTYPE_ROW16(f, (c) + 48)
+#define CTYPE_TABLE(f) { CTYPE_ROW64(f, 0), CTYPE_ROW64(f, 64), CTYPE_ROW64(f, 128), CTYPE_ROW64(f, 192) }
+
+const unsigned char ctype_flags[256] = CTYPE_TABLE(CTYPE_FLAGS);
+const unsigned char ctype_upper[256] = CTYPE_TABLE(CTYPE_UPPER);
+
+typedef struct s_ctype_case {
+    const char *name;
+    int (*ft)(int);
+    int (*libc)(int);
+    int predicate;
+} t_ctype_case;
+
+// Values outside EOF..UCHAR_MAX are undefined for <ctype.h>, so these are
+// only expected to be outside every class and unchanged by case mapping
+static const int ctype_sentinels[] = {INT_MIN, -1000, -129, -128, -2, 256, 257, 1000, INT_MAX};
+
+void test_ctype_exhaustive(void) {
+    static const t_ctype_case cases[] = {
+        {"ft_isalpha", ft_isalpha, isalpha, 1},
+        {"ft_isdigit", ft_isdigit, isdigit, 1},
+        {"ft_isalnum", ft_isalnum, isalnum, 1},
+        {"ft_isascii", ft_isascii, isascii, 1},
+        {"ft_isprint", ft_isprint, isprint, 1},
+        {"ft_toupper", ft_toupper, toupper, 0},
+        {"ft_tolower", ft_tolower, tolower, 0},
+    };
+    char msg[96];
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(*cases); i++) {
+        const t_ctype_case *t = &cases[i];
+
+        for (int c = EOF; c <= UCHAR_MAX; c++) {
+            int got = t->ft(c);
+            int want = t->libc(c);
+
+            if (t->predicate ? (got != 0) != (want != 0) : got != want) {
+                snprintf(msg, sizeof(msg), "%s(%d) = %d, <ctype.h> gives %d", t->name, c, got, want);
+                TEST_FAIL_MESSAGE(msg);
+            }
+        }
+        for (size_t s = 0; s < sizeof(ctype_sentinels) / sizeof(*ctype_sentinels); s++) {
+            int c = ctype_sentinels[s];
+            int got = t->ft(c);
+
+            if (t->predicate ? got != 0 : got != c) {
+                snprintf(msg, sizeof(msg), "%s(%d) = %d for an out-of-range value", t->name, c, got);
+                TEST_FAIL_MESSAGE(msg);
+            }
+        }
+    }
+
+    // The benchmark baseline must agree with <ctype.h> too
+    for (int c = 0; c <= UCHAR_MAX; c++) {
+        TEST_ASSERT_EQUAL_MESSAGE(isalpha(c) != 0, (ctype_flags[c] & CTYPE_ALPHA) != 0, "ctype_flags alpha");
+        TEST_ASSERT_EQUAL_MESSAGE(isdigit(c) != 0, (ctype_flags[c] & CTYPE_DIGIT) != 0, "ctype_flags digit");
+        TEST_ASSERT_EQUAL_MESSAGE(isprint(c) != 0, (ctype_flags[c] & CTYPE_PRINT) != 0, "ctype_flags print");
+        TEST_ASSERT_EQUAL_MESSAGE(toupper(c), ctype_upper[c], "ctype_upper");
+    }
+}
@@ -0,0 +1,97 @@
+#include "test_libft.h"
+
+const char test_fd_file[] = __FILE__;
+
+// Helper function to name the scratch file per process, so parallel
+// workers (TEST_JOBS) do not overwrite each other's temp file
+static const char *temp_path(void) {
+    static char path[32];
+
+    snprintf(path, sizeof(path), "temp_%ld.txt", (long)getpid());
+    return path;
+}
+
+// Helper function to create a temporary file
+int create_temp_file(const char *content) {
+    int fd = open(temp_path(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd != -1) {
+        write(fd, content, strlen(content));
+        close(fd);
+    }
+    return fd;
+}
+
+// Helper function for detailed error reporting
+void report_error(const char *test_name, const char *expected, const char *actual) {
+    printf("\nTest Failed: %s\n", test_name);
+    printf("Expected: %s\n", expected);
+    printf("Actual: %s\n", actual);
+}
+
+void test_putchar_fd(void) {
+    int fd = open(temp_path(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    TEST_ASSERT_NOT_EQUAL(-1, fd);
+    
+    ft_putchar_fd('A', fd);
+    close(fd);
+    
+    fd = open(temp_path(), O_RDONLY);
+    TEST_ASSERT_NOT_EQUAL(-1, fd);
+    char c;
+    ssize_t bytes_read = read(fd, &c, 1);
+    TEST_ASSERT_EQUAL(1, bytes_read);
+    TEST_ASSERT_EQUAL('A', c);
+    close(fd);
+    unlink(temp_path());
+}
+
+void test_putstr_fd(void) {
+    int fd = open(temp_path(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    TEST_ASSERT_NOT_EQUAL(-1, fd);
+    
+    ft_putstr_fd("Hello", fd);
+    close(fd);
+    
+    fd = open(temp_path(), O_RDONLY);
+    TEST_ASSERT_NOT_EQUAL(-1, fd);
+    char str[10] = {0};
+    ssize_t bytes_read = read(fd, str, 5);
+    TEST_ASSERT_EQUAL(5, bytes_read);
+    TEST_ASSERT_EQUAL_STRING("Hello", str);
+    close(fd);
+    unlink(temp_path());
+}
+
+void test_putendl_fd(void) {
+    int fd = open(temp_path(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    TEST_ASSERT_NOT_EQUAL(-1, fd);
+    
+    ft_putendl_fd("Hello", fd);
+    close(fd);
+    
+    fd = open(temp_path(), O_RDONLY);
+    TEST_ASSERT_NOT_EQUAL(-1, fd);
+    char str[10] = {0};
+    ssize_t bytes_read = read(fd, str, 6);
+    TEST_ASSERT_EQUAL(6, bytes_read);
+    TEST_ASSERT_EQUAL_STRING("Hello\n", str);
+    close(fd);
+    unlink(temp_path());
+}
+
+void test_putnbr_fd(void) {
+    int fd = open(temp_path(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    TEST_ASSERT_NOT_EQUAL(-1, fd);
+    
+    ft_putnbr_fd(42, fd);
+    close(fd);
+    
+    fd = open(temp_path(), O_RDONLY);
+    TEST_ASSERT_NOT_EQUAL(-1, fd);
+    char str[10] = {0};
+    ssize_t bytes_read = read(fd, str, 2);
+    TEST_ASSERT_EQUAL(2, bytes_read);
+    TEST_ASSERT_EQUAL_STRING("42", str);
+    close(fd);
+    unlink(temp_path());
+}
@@ -0,0 +1,307 @@
+#ifndef TEST_LIBFT_H
+# define TEST_LIBFT_H
+
+#include "../Libft/libft.h"
+#include "unity/unity.h"
+#include <string.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <math.h>
+#include <stdint.h>
+#ifdef ALLOC_TRACE
+# include <dlfcn.h>
+#endif
+#include <sys/wait.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef __linux__
+# include <errno.h>
+# include <sched.h>
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+#endif
+
+// Allocation profiler (test_alloc.c)
+#define ALLOC_CLASSES 10    // <=16, <=32, ... <=4 KiB, larger
+#define ALLOC_MAX_TESTS 128
+
+typedef struct s_alloc_profile {
+    size_t allocations;
+    size_t frees;
+    size_t bytes;
+    size_t histogram[ALLOC_CLASSES];
+} t_alloc_profile;
+
+typedef struct s_alloc_test_profile {
+    const char *name;
+    t_alloc_profile profile;
+} t_alloc_test_profile;
+
+extern t_alloc_test_profile alloc_test_profiles[ALLOC_MAX_TESTS];
+extern size_t alloc_test_count;
+#ifdef ALLOC_TRACE
+extern size_t leak_total_bytes;
+extern size_t leak_total_blocks;
+extern size_t leak_tests;
+#endif
+
+void alloc_trace_begin(void);
+void alloc_trace_end(t_alloc_profile *out);
+void print_alloc_profile(const t_alloc_profile *profile);
+void print_test_alloc_profiles(void);
+void check_memory_leaks(void);
+
+// Benchmark engine (bench.c)
+typedef struct s_bench_config {
+    size_t warmup;      // untimed calls before sampling
+    size_t iterations;  // number of timed samples
+} t_bench_config;
+
+typedef struct s_bench_stats {
+    size_t samples;
+    size_t batch;       // calls per timed sample
+    double min_ns;
+    double median_ns;
+    double mean_ns;
+    double p99_ns;
+    double stddev_ns;
+} t_bench_stats;
+
+enum e_bench_counter {
+    COUNTER_CYCLES,
+    COUNTER_INSTRUCTIONS,
+    COUNTER_L1D_MISSES,
+    COUNTER_LLC_MISSES,
+    COUNTER_BRANCH_MISSES,
+    COUNTER_COUNT
+};
+
+typedef struct s_bench_counters {
+    int valid;                      // at least one counter was read
+    int have[COUNTER_COUNT];
+    double per_call[COUNTER_COUNT];
+} t_bench_counters;
+
+// Optimization barriers: BENCH_KEEP forces a result to be materialized,
+// BENCH_ESCAPE makes the compiler assume a buffer is read and written
+extern volatile uintptr_t bench_sink;
+#define BENCH_KEEP(value) (bench_sink = (uintptr_t)(value))
+#define BENCH_ESCAPE(ptr) __asm__ volatile("" : : "g"(ptr) : "memory")
+
+extern int bench_counters_state;    // 0 = not tried, 1 = open, -1 = unavailable
+extern const char *perf_path;
+extern int perf_checking;
+
+size_t bench_env_size(const char *name, size_t fallback);
+t_bench_config bench_default_config(void);
+double measure_time_ns(void (*test_func)(void), size_t batch);
+void bench_compute_stats(double *samples, size_t count, t_bench_stats *stats);
+int bench_counters_open(void);
+void bench_counters_close(void);
+int run_benchmark(void (*test_func)(void), const t_bench_config *config, t_bench_stats *stats);
+int run_benchmark_counted(void (*test_func)(void), const t_bench_config *config,
+                          t_bench_stats *stats, t_bench_counters *counters);
+void bench_release(void);
+void perf_init(void);
+void perf_observe(const char *name, size_t size, const t_bench_stats *stats,
+                  void (*kernel)(void), const t_bench_config *config);
+int perf_finish(void);
+void print_performance_result(const char *test_name, const t_bench_stats *stats);
+void print_counter_result(const t_bench_counters *counters);
+void run_performance_test(const char *test_name, size_t input_size, void (*test_func)(void));
+
+// Benchmark inputs and kernels (bench_kernels.c)
+#define BENCH_TEXT_SIZE 4096
+#define BENCH_NUMBER_COUNT 64
+#define BENCH_SENTENCE_SIZE 512
+
+void bench_setup(void);
+void run_mem_size_sweep(void);
+void run_libc_comparison(void);
+void run_align_matrix(void);
+// Per-call latency histograms (bench_latency.c)
+void run_latency_histograms(void);
+// Worst-case ft_strnstr inputs (bench_adversarial.c); returns 1 for a missed
+// match plus 1 for O(n*m) growth
+int run_strnstr_adversarial(void);
+// Complexity-class detection (bench_complexity.c); returns the number of
+// functions that grow faster than expected in every pass
+int run_complexity_detection(void);
+// Large-list scaling and node placement (bench_list.c)
+void run_list_scaling(void);
+void run_list_locality(void);
+// Multi-threaded throughput scaling (test_threads.c)
+void run_thread_scaling(void);
+void bench_isalpha(void);
+void bench_isdigit(void);
+void bench_isalnum(void);
+void bench_isprint(void);
+void bench_toupper(void);
+void bench_alnum_rand(void);
+void bench_alnum_lut_rand(void);
+void bench_alnum_sort(void);
+void bench_alnum_lut_sort(void);
+void bench_upper_rand(void);
+void bench_upper_lut_rand(void);
+void bench_upper_sort(void);
+void bench_upper_lut_sort(void);
+void bench_strlen(void);
+void bench_strchr(void);
+void bench_strrchr(void);
+void bench_strncmp(void);
+void bench_strnstr(void);
+void bench_atoi(void);
+void bench_strdup(void);
+void bench_substr(void);
+void bench_strjoin(void);
+void bench_strtrim(void);
+void bench_split(void);
+void bench_itoa(void);
+
+// Shared reference data: ctype tables (test_ctype.c) and the alignment and
+// overlap grid (test_memory.c), also used by the benchmarks
+#define CTYPE_ALPHA 0x01
+#define CTYPE_DIGIT 0x02
+#define CTYPE_PRINT 0x04
+// Every ctype function test_ctype_exhaustive sweeps, for TEST_SYMBOLS
+#define CTYPE_SYMBOLS "ft_isalpha ft_isdigit ft_isalnum ft_isascii ft_isprint ft_toupper ft_tolower"
+#define ALIGN_MAX_OFFSET 64
+#define OVERLAP_DISTANCE_COUNT 14
+
+extern const unsigned char ctype_flags[256];
+extern const unsigned char ctype_upper[256];
+extern const size_t overlap_distances[OVERLAP_DISTANCE_COUNT];
+
+// Test and benchmark registry (test_runner.c). Each row is a stage header,
+// a Unity test or a benchmark kernel; run_jobs() runs the rows serially or
+// on a worker pool
+typedef struct s_job {
+    const char *stage;          // stage header row when non-NULL
+    const char *name;
+    int line;                   // row in the job table (test_main.c)
+    const char *file;           // module defining the test
+    UnityTestFunction test;     // Unity test, or
+    void (*kernel)(void);       // benchmark kernel
+    size_t size;                // benchmark input size (baseline key)
+    const char *uses;           // ft_ symbols exercised, when not implied by name
+} t_job;
+
+#define TEST_STAGE(title) {title, NULL, 0, NULL, NULL, NULL, 0, NULL}
+// module names the test_<module>.c defining func, whose test_<module>_file
+// is where assertion failures inside the test are reported
+#define TEST_CASE(module, func) {NULL, #func, __LINE__, test_##module##_file, func, NULL, 0, NULL}
+#define TEST_CASE_USES(module, func, uses) {NULL, #func, __LINE__, test_##module##_file, func, NULL, 0, uses}
+// Benchmark kernels are named bench_<function> and report as <function>
+#define BENCH(kernel, size) {NULL, (#kernel) + sizeof("bench_") - 1, __LINE__, NULL, NULL, kernel, size, NULL}
+#define BENCH_USES(kernel, size, uses) {NULL, (#kernel) + sizeof("bench_") - 1, __LINE__, NULL, NULL, kernel, size, uses}
+#define BENCH_STAGE(title) TEST_STAGE(title)
+#define JOB_COUNT(table) (sizeof(table) / sizeof(*(table)))
+
+int test_worker_count(void);
+size_t filter_jobs(const t_job *jobs, size_t count, const char *symbols, t_job *out);
+void run_jobs(const t_job *jobs, size_t count, int workers, int isolate);
+
+// Output helpers (test_main.c) and file helpers (test_fd.c)
+void print_section_header(const char *title);
+void print_test_stage(const char *stage);
+void print_test_result(const char *test_name, int passed);
+int create_temp_file(const char *content);
+void report_error(const char *test_name, const char *expected, const char *actual);
+
+// Tests, grouped by module. Each module defines test_<module>_file as its
+// __FILE__ for TEST_CASE
+// test_ctype.c
+extern const char test_ctype_file[];
+void test_isalpha(void);
+void test_isdigit(void);
+void test_isalnum(void);
+void test_isascii(void);
+void test_isprint(void);
+void test_toupper(void);
+void test_tolower(void);
+void test_ctype_exhaustive(void);
+
+// test_string.c
+extern const char test_string_file[];
+void test_strlen(void);
+void test_strlcpy(void);
+void test_strlcat(void);
+void test_strchr(void);
+void test_strrchr(void);
+void test_strncmp(void);
+void test_strnstr(void);
+void test_atoi(void);
+void test_substr(void);
+void test_strjoin(void);
+void test_strtrim(void);
+void test_split(void);
+void test_itoa(void);
+void test_strmapi(void);
+void test_striteri(void);
+
+// test_memory.c
+extern const char test_memory_file[];
+void test_memset(void);
+void test_bzero(void);
+void test_memcpy(void);
+void test_memmove(void);
+void test_memcpy_alignment(void);
+void test_memmove_alignment(void);
+void test_memmove_overlap(void);
+void test_memchr(void);
+void test_memcmp(void);
+
+// test_alloc.c
+extern const char test_alloc_file[];
+void test_calloc(void);
+void test_strdup(void);
+
+// test_fd.c
+extern const char test_fd_file[];
+void test_putchar_fd(void);
+void test_putstr_fd(void);
+void test_putendl_fd(void);
+void test_putnbr_fd(void);
+
+// test_vectors.c
+extern const char test_vectors_file[];
+void test_atoi_vectors(void);
+void test_itoa_vectors(void);
+void test_strncmp_vectors(void);
+void test_strnstr_vectors(void);
+
+// test_properties.c
+extern const char test_properties_file[];
+void test_split_properties(void);
+void test_strtrim_properties(void);
+void test_substr_properties(void);
+void test_strjoin_properties(void);
+
+// test_threads.c
+extern const char test_threads_file[];
+void test_thread_reentrancy(void);
+
+// test_list.c
+extern const char test_list_file[];
+void test_lstnew(void);
+void test_lstadd_front(void);
+void test_lstsize(void);
+void test_lstlast(void);
+void test_lstadd_back(void);
+void test_lstdelone(void);
+void test_lstclear(void);
+void test_lstiter(void);
+void test_lstmap(void);
+
+#endif
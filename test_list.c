@@ -0,0 +1,361 @@
+#include "test_libft.h"
+
+const char test_list_file[] = __FILE__;
+
+// Helper functions for list tests
+static void modify_content(void *content) {
+    char *str = (char *)content;
+    str[0] = 'X';
+}
+
+static void *map_content(void *content) {
+    char *str = (char *)content;
+    char *new_str = strdup(str);
+    new_str[0] = 'X';
+    return new_str;
+}
+
+// Dummy free function for integer content
+static void dummy_free(void *ptr) { (void)ptr; }
+
+// Bonus list functions tests
+void test_lstnew(void) {
+    t_list *node;
+    
+    // Test with normal content
+    int content = 42;
+    node = ft_lstnew(&content);
+    TEST_ASSERT_NOT_NULL(node);
+    TEST_ASSERT_EQUAL_PTR(&content, node->content);
+    TEST_ASSERT_NULL(node->next);
+    free(node);
+    
+    // Test with NULL content
+    node = ft_lstnew(NULL);
+    TEST_ASSERT_NOT_NULL(node);
+    TEST_ASSERT_NULL(node->content);
+    TEST_ASSERT_NULL(node->next);
+    free(node);
+    
+    // Test with string content
+    char *str = strdup("test");
+    node = ft_lstnew(str);
+    TEST_ASSERT_NOT_NULL(node);
+    TEST_ASSERT_EQUAL_STRING("test", (char *)node->content);
+    TEST_ASSERT_NULL(node->next);
+    free(node->content);
+    free(node);
+}
+
+void test_lstadd_front(void) {
+    t_list *list = NULL;
+    int content1 = 1;
+    int content2 = 2;
+    int content3 = 3;
+    
+    // Test adding to empty list
+    t_list *node1 = ft_lstnew(&content1);
+    ft_lstadd_front(&list, node1);
+    TEST_ASSERT_EQUAL_PTR(node1, list);
+    TEST_ASSERT_NULL(node1->next);
+    
+    // Test adding to non-empty list
+    t_list *node2 = ft_lstnew(&content2);
+    ft_lstadd_front(&list, node2);
+    TEST_ASSERT_EQUAL_PTR(node2, list);
+    TEST_ASSERT_EQUAL_PTR(node1, node2->next);
+    TEST_ASSERT_NULL(node1->next);
+    
+    // Test adding multiple nodes
+    t_list *node3 = ft_lstnew(&content3);
+    ft_lstadd_front(&list, node3);
+    TEST_ASSERT_EQUAL_PTR(node3, list);
+    TEST_ASSERT_EQUAL_PTR(node2, node3->next);
+    TEST_ASSERT_EQUAL_PTR(node1, node2->next);
+    TEST_ASSERT_NULL(node1->next);
+    
+    // Clean up
+    ft_lstclear(&list, dummy_free);
+    
+    // Test with NULL list pointer
+    list = NULL;
+    t_list *node4 = ft_lstnew(&content1);
+    ft_lstadd_front(NULL, node4);
+    free(node4);
+    
+    // Test with NULL new node
+    list = NULL;
+    ft_lstadd_front(&list, NULL);
+    TEST_ASSERT_NULL(list);
+}
+
+void test_lstsize(void) {
+    t_list *list = NULL;
+    int content1 = 1;
+    int content2 = 2;
+    int content3 = 3;
+    
+    // Test empty list
+    TEST_ASSERT_EQUAL(0, ft_lstsize(list));
+    
+    // Test single node
+    t_list *node1 = ft_lstnew(&content1);
+    list = node1;
+    TEST_ASSERT_EQUAL(1, ft_lstsize(list));
+    
+    // Test multiple nodes
+    t_list *node2 = ft_lstnew(&content2);
+    t_list *node3 = ft_lstnew(&content3);
+    node1->next = node2;
+    node2->next = node3;
+    TEST_ASSERT_EQUAL(3, ft_lstsize(list));
+    
+    // Clean up
+    ft_lstclear(&list, dummy_free);
+    
+    // Test NULL list
+    TEST_ASSERT_EQUAL(0, ft_lstsize(NULL));
+}
+
+void test_lstlast(void) {
+    t_list *list = NULL;
+    int content1 = 1;
+    int content2 = 2;
+    int content3 = 3;
+    
+    // Test empty list
+    TEST_ASSERT_NULL(ft_lstlast(list));
+    
+    // Test single node
+    t_list *node1 = ft_lstnew(&content1);
+    list = node1;
+    TEST_ASSERT_EQUAL_PTR(node1, ft_lstlast(list));
+    
+    // Test multiple nodes
+    t_list *node2 = ft_lstnew(&content2);
+    t_list *node3 = ft_lstnew(&content3);
+    node1->next = node2;
+    node2->next = node3;
+    TEST_ASSERT_EQUAL_PTR(node3, ft_lstlast(list));
+    
+    // Clean up
+    ft_lstclear(&list, dummy_free);
+    
+    // Test NULL list
+    TEST_ASSERT_NULL(ft_lstlast(NULL));
+}
+
+void test_lstadd_back(void) {
+    t_list *list = NULL;
+    int content1 = 1;
+    int content2 = 2;
+    int content3 = 3;
+    
+    // Test adding to empty list
+    t_list *node1 = ft_lstnew(&content1);
+    ft_lstadd_back(&list, node1);
+    TEST_ASSERT_EQUAL_PTR(node1, list);
+    TEST_ASSERT_NULL(node1->next);
+    
+    // Test adding to non-empty list
+    t_list *node2 = ft_lstnew(&content2);
+    ft_lstadd_back(&list, node2);
+    TEST_ASSERT_EQUAL_PTR(node1, list);
+    TEST_ASSERT_EQUAL_PTR(node2, node1->next);
+    TEST_ASSERT_NULL(node2->next);
+    
+    // Test adding multiple nodes
+    t_list *node3 = ft_lstnew(&content3);
+    ft_lstadd_back(&list, node3);
+    TEST_ASSERT_EQUAL_PTR(node1, list);
+    TEST_ASSERT_EQUAL_PTR(node2, node1->next);
+    TEST_ASSERT_EQUAL_PTR(node3, node2->next);
+    TEST_ASSERT_NULL(node3->next);
+    
+    // Clean up
+    ft_lstclear(&list, dummy_free);
+    
+    // Test with NULL list pointer
+    list = NULL;
+    t_list *node4 = ft_lstnew(&content1);
+    ft_lstadd_back(NULL, node4);
+    free(node4);
+    
+    // Test with NULL new node
+    list = NULL;
+    ft_lstadd_back(&list, NULL);
+    TEST_ASSERT_NULL(list);
+}
+
+void test_lstdelone(void) {
+    // Test with normal node
+    char *str1 = strdup("test1");
+    t_list *node1 = ft_lstnew(str1);
+    ft_lstdelone(node1, free);  // This frees both content and node
+    
+    // Test with NULL node
+    ft_lstdelone(NULL, free);
+    
+    // Test with NULL del function
+    char *str2 = strdup("test2");
+    t_list *node2 = ft_lstnew(str2);
+    ft_lstdelone(node2, NULL);  // This doesn't free anything
+    free(str2);  // Free the content manually
+    free(node2);  // Free the node manually
+    
+    // Test with integer content
+    int content = 42;
+    t_list *node3 = ft_lstnew(&content);
+    ft_lstdelone(node3, dummy_free);  // This frees both content and node
+}
+
+void test_lstclear(void) {
+    t_list *list = NULL;
+    
+    // Test with empty list
+    ft_lstclear(&list, free);
+    TEST_ASSERT_NULL(list);
+    
+    // Test with single node
+    char *str1 = strdup("test1");
+    t_list *node1 = ft_lstnew(str1);
+    list = node1;
+    ft_lstclear(&list, free);
+    TEST_ASSERT_NULL(list);
+    
+    // Test with multiple nodes
+    char *str2 = strdup("test2");
+    char *str3 = strdup("test3");
+    t_list *node2 = ft_lstnew(str2);
+    t_list *node3 = ft_lstnew(str3);
+    node2->next = node3;
+    list = node2;
+    ft_lstclear(&list, free);
+    TEST_ASSERT_NULL(list);
+    
+    // Test with NULL list pointer
+    ft_lstclear(NULL, free);
+    
+    // Test with NULL del function
+    char *str4 = strdup("test4");
+    node1 = ft_lstnew(str4);
+    list = node1;
+    ft_lstclear(&list, NULL);
+    free(str4);
+    free(node1);
+}
+
+void test_lstiter(void) {
+    t_list *list = NULL;
+    
+    // Test with empty list
+    ft_lstiter(list, NULL);
+    
+    // Test with single node
+    char *str1 = strdup("test1");
+    t_list *node1 = ft_lstnew(str1);
+    list = node1;
+    ft_lstiter(list, NULL);
+    
+    // Test with multiple nodes
+    char *str2 = strdup("test2");
+    char *str3 = strdup("test3");
+    t_list *node2 = ft_lstnew(str2);
+    t_list *node3 = ft_lstnew(str3);
+    node1->next = node2;
+    node2->next = node3;
+    
+    // Test with NULL function
+    ft_lstiter(list, NULL);
+    
+    // Test with function
+    ft_lstiter(list, modify_content);
+    TEST_ASSERT_EQUAL_STRING("Xest1", (char *)node1->content);
+    TEST_ASSERT_EQUAL_STRING("Xest2", (char *)node2->content);
+    TEST_ASSERT_EQUAL_STRING("Xest3", (char *)node3->content);
+    
+    // Clean up
+    ft_lstclear(&list, free);
+}
+
+void test_lstmap(void) {
+    t_list *list = NULL;
+    t_list *new_list = NULL;
+    
+    // Test with empty list
+    TEST_ASSERT_NULL(ft_lstmap(NULL, NULL, NULL));
+    
+    // Test with single node
+    char *str1 = strdup("test1");
+    t_list *node1 = ft_lstnew(str1);
+    list = node1;
+    
+    // Test with NULL functions
+    TEST_ASSERT_NULL(ft_lstmap(list, NULL, NULL));
+    
+    // Test with function
+    new_list = ft_lstmap(list, map_content, free);
+    TEST_ASSERT_NOT_NULL(new_list);
+    TEST_ASSERT_EQUAL_STRING("Xest1", (char *)new_list->content);
+    TEST_ASSERT_NULL(new_list->next);
+    
+    ft_lstclear(&new_list, free);
+    
+    // Test with multiple nodes
+    char *str2 = strdup("test2");
+    char *str3 = strdup("test3");
+    t_list *node2 = ft_lstnew(str2);
+    t_list *node3 = ft_lstnew(str3);
+    node1->next = node2;
+    node2->next = node3;
+    
+    new_list = ft_lstmap(list, map_content, free);
+    TEST_ASSERT_NOT_NULL(new_list);
+    TEST_ASSERT_EQUAL_STRING("Xest1", (char *)new_list->content);
+    TEST_ASSERT_NOT_NULL(new_list->next);
+    TEST_ASSERT_EQUAL_STRING("Xest2", (char *)new_list->next->content);
+    TEST_ASSERT_NOT_NULL(new_list->next->next);
+    TEST_ASSERT_EQUAL_STRING("Xest3", (char *)new_list->next->next->content);
+    TEST_ASSERT_NULL(new_list->next->next->next);
+    
+    // Clean up
+    ft_lstclear(&new_list, free);
+    ft_lstclear(&list, free);
+}
+
+void test_lstdelone_direct(void) {
+    printf("\n=== Testing ft_lstdelone directly ===\n");
+    
+    // Test 1: Normal case with free
+    printf("\nTest 1: Normal case with free\n");
+    char *str1 = strdup("test1");
+    t_list *node1 = ft_lstnew(str1);
+    printf("Before: node1=%p, content=%s\n", (void*)node1, (char*)node1->content);
+    ft_lstdelone(node1, free);
+    printf("After: node1=%p\n", (void*)node1);
+    
+    // Test 2: NULL node
+    printf("\nTest 2: NULL node\n");
+    ft_lstdelone(NULL, free);
+    printf("No crash with NULL node\n");
+    
+    // Test 3: NULL del function
+    printf("\nTest 3: NULL del function\n");
+    char *str2 = strdup("test2");
+    t_list *node2 = ft_lstnew(str2);
+    printf("Before: node2=%p, content=%s\n", (void*)node2, (char*)node2->content);
+    ft_lstdelone(node2, NULL);
+    printf("After: node2=%p, content=%s\n", (void*)node2, (char*)node2->content);
+    free(str2);
+    free(node2);
+    
+    // Test 4: Integer content with dummy_free
+    printf("\nTest 4: Integer content with dummy_free\n");
+    int content = 42;
+    t_list *node3 = ft_lstnew(&content);
+    printf("Before: node3=%p, content=%d\n", (void*)node3, *(int*)node3->content);
+    ft_lstdelone(node3, dummy_free);
+    printf("After: node3=%p\n", (void*)node3);
+    
+    printf("\n=== Direct test complete ===\n");
+}
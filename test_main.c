@@ -0,0 +1,260 @@
+#include "test_libft.h"
+
+// Unity output backend (see unity_config.h). stdout is switched to a large
+// fully buffered stream so a test's result line, failure messages and any
+// printf output between tests leave in a single write() when Unity
+// concludes the test. TEST_QUIET=1 makes passing tests print nothing
+#define UNITY_OUTPUT_BUFFER_SIZE (1 << 16)
+
+static int unity_quiet = -1;
+
+void unity_output_char(int c) {
+    putc_unlocked(c, stdout);
+}
+
+void unity_output_flush(void) {
+    fflush(stdout);
+}
+
+int unity_output_quiet(void) {
+    if (unity_quiet < 0)
+        unity_quiet = getenv("TEST_QUIET") != NULL;
+    return unity_quiet;
+}
+
+// Must run before anything is printed
+static void unity_output_init(void) {
+    static char buffer[UNITY_OUTPUT_BUFFER_SIZE];
+
+    setvbuf(stdout, buffer, _IOFBF, sizeof(buffer));
+}
+
+// Helper function to print section header
+void print_section_header(const char *title) {
+    printf("\n\033[1;35m=== %s ===\033[0m\n", title);
+}
+
+// Helper function to print test stage
+void print_test_stage(const char *stage) {
+    printf("\n\033[1;34m%s\033[0m\n", stage);
+}
+
+// Helper function to print test result
+void print_test_result(const char *test_name, int passed) {
+    if (passed) {
+        printf("  \033[1;32m✓ %s\033[0m\n", test_name);
+    } else {
+        printf("  \033[1;31m✗ %s\033[0m\n", test_name);
+    }
+}
+
+static const t_job test_jobs[] = {
+    TEST_STAGE("Stage 1: Basic character and string functions"),
+    TEST_CASE(ctype, test_isalpha),
+    TEST_CASE(ctype, test_isdigit),
+    TEST_CASE(ctype, test_isalnum),
+    TEST_CASE(ctype, test_isascii),
+    TEST_CASE(ctype, test_isprint),
+    TEST_CASE(string, test_strlen),
+    TEST_CASE(memory, test_memset),
+    TEST_CASE(memory, test_bzero),
+    TEST_CASE(memory, test_memcpy),
+    TEST_CASE(memory, test_memmove),
+    TEST_CASE(memory, test_memcpy_alignment),
+    TEST_CASE(memory, test_memmove_alignment),
+    TEST_CASE(memory, test_memmove_overlap),
+    TEST_CASE(string, test_strlcpy),
+    TEST_CASE(string, test_strlcat),
+    TEST_CASE(ctype, test_toupper),
+    TEST_CASE(ctype, test_tolower),
+    TEST_CASE_USES(ctype, test_ctype_exhaustive, CTYPE_SYMBOLS),
+
+    TEST_STAGE("Stage 2: String search and comparison functions"),
+    TEST_CASE(string, test_strchr),
+    TEST_CASE(string, test_strrchr),
+    TEST_CASE(string, test_strncmp),
+    TEST_CASE(memory, test_memchr),
+    TEST_CASE(memory, test_memcmp),
+    TEST_CASE(string, test_strnstr),
+    TEST_CASE(string, test_atoi),
+
+    TEST_STAGE("Stage 3: Memory allocation functions"),
+    TEST_CASE(alloc, test_calloc),
+    TEST_CASE(alloc, test_strdup),
+
+    TEST_STAGE("Stage 4: String manipulation functions"),
+    TEST_CASE(string, test_substr),
+    TEST_CASE(string, test_strjoin),
+    TEST_CASE(string, test_strtrim),
+    TEST_CASE(string, test_split),
+    TEST_CASE(string, test_itoa),
+    TEST_CASE(string, test_strmapi),
+    TEST_CASE(string, test_striteri),
+
+    TEST_STAGE("Stage 5: File descriptor functions"),
+    TEST_CASE(fd, test_putchar_fd),
+    TEST_CASE(fd, test_putstr_fd),
+    TEST_CASE(fd, test_putendl_fd),
+    TEST_CASE(fd, test_putnbr_fd),
+
+    TEST_STAGE("Stage 6: Test vectors"),
+    TEST_CASE(vectors, test_atoi_vectors),
+    TEST_CASE(vectors, test_itoa_vectors),
+    TEST_CASE(vectors, test_strncmp_vectors),
+    TEST_CASE(vectors, test_strnstr_vectors),
+
+    TEST_STAGE("Stage 7: Property-based tests"),
+    TEST_CASE(properties, test_split_properties),
+    TEST_CASE(properties, test_strtrim_properties),
+    TEST_CASE(properties, test_substr_properties),
+    TEST_CASE(properties, test_strjoin_properties),
+
+    TEST_STAGE("Stage 8: Thread reentrancy"),
+    TEST_CASE_USES(threads, test_thread_reentrancy, "ft_itoa ft_split ft_strjoin ft_strdup ft_substr ft_lstmap"),
+
+#ifdef BONUS
+    TEST_STAGE("Stage 9: Bonus list functions"),
+    TEST_CASE(list, test_lstnew),
+    TEST_CASE(list, test_lstadd_front),
+    TEST_CASE(list, test_lstsize),
+    TEST_CASE(list, test_lstlast),
+    TEST_CASE(list, test_lstadd_back),
+    TEST_CASE(list, test_lstdelone),
+    TEST_CASE(list, test_lstclear),
+    TEST_CASE(list, test_lstiter),
+    TEST_CASE(list, test_lstmap),
+#endif
+};
+
+static const t_job bench_jobs[] = {
+    // Character classification over a 4 KiB request-like buffer
+    BENCH_STAGE("Benchmarking character functions"),
+    BENCH(bench_isalpha, BENCH_TEXT_SIZE),
+    BENCH(bench_isdigit, BENCH_TEXT_SIZE),
+    BENCH(bench_isalnum, BENCH_TEXT_SIZE),
+    BENCH(bench_isprint, BENCH_TEXT_SIZE),
+    BENCH(bench_toupper, BENCH_TEXT_SIZE),
+
+    // ft_ classifiers vs lookup tables on random and sorted bytes
+    BENCH_STAGE("Benchmarking ctype lookup tables"),
+    BENCH_USES(bench_alnum_rand, BENCH_TEXT_SIZE, "ft_isalnum"),
+    BENCH_USES(bench_alnum_lut_rand, BENCH_TEXT_SIZE, "ft_isalnum"),
+    BENCH_USES(bench_alnum_sort, BENCH_TEXT_SIZE, "ft_isalnum"),
+    BENCH_USES(bench_alnum_lut_sort, BENCH_TEXT_SIZE, "ft_isalnum"),
+    BENCH_USES(bench_upper_rand, BENCH_TEXT_SIZE, "ft_toupper"),
+    BENCH_USES(bench_upper_lut_rand, BENCH_TEXT_SIZE, "ft_toupper"),
+    BENCH_USES(bench_upper_sort, BENCH_TEXT_SIZE, "ft_toupper"),
+    BENCH_USES(bench_upper_lut_sort, BENCH_TEXT_SIZE, "ft_toupper"),
+
+    // Scanning and comparison functions
+    BENCH_STAGE("Benchmarking string scanning functions"),
+    BENCH(bench_strlen, BENCH_TEXT_SIZE),
+    BENCH(bench_strchr, BENCH_TEXT_SIZE),
+    BENCH(bench_strrchr, BENCH_TEXT_SIZE),
+    BENCH(bench_strncmp, BENCH_TEXT_SIZE),
+    BENCH(bench_strnstr, BENCH_TEXT_SIZE),
+    BENCH(bench_atoi, BENCH_NUMBER_COUNT),
+
+    // Allocating string functions
+    BENCH_STAGE("Benchmarking allocating string functions"),
+    BENCH(bench_strdup, BENCH_SENTENCE_SIZE),
+    BENCH(bench_substr, 256),
+    BENCH(bench_strjoin, 2 * BENCH_SENTENCE_SIZE),
+    BENCH(bench_strtrim, BENCH_TEXT_SIZE),
+    BENCH(bench_split, BENCH_SENTENCE_SIZE),
+    BENCH(bench_itoa, BENCH_NUMBER_COUNT),
+};
+
+// Modify main to run tests in stages
+int main(void) {
+    int workers = test_worker_count();
+    int isolate = getenv("TEST_ISOLATE") != NULL;
+    // TEST_SYMBOLS narrows both tables to the jobs exercising those ft_ symbols
+    const char *symbols = getenv("TEST_SYMBOLS");
+    t_job tests[JOB_COUNT(test_jobs)];
+    t_job benches[JOB_COUNT(bench_jobs)];
+    size_t test_count = filter_jobs(test_jobs, JOB_COUNT(test_jobs), symbols, tests);
+    size_t bench_count = filter_jobs(bench_jobs, JOB_COUNT(bench_jobs), symbols, benches);
+
+    unity_output_init();
+    UNITY_BEGIN();
+    // Build shared inputs once; isolated jobs fork from this state
+    bench_setup();
+    
+    print_section_header("Running Standard Tests");
+    run_jobs(tests, test_count, workers, isolate);
+    
+    print_section_header("Allocation Profile per Test");
+    print_test_alloc_profiles();
+    check_memory_leaks();
+    
+    print_section_header("Running Performance Tests");
+    
+    perf_init();
+    // Probe counter access once, so workers inherit an "unavailable" result
+    bench_counters_open();
+    // Baseline samples are collected in-process, so record/check runs serially
+    run_jobs(benches, bench_count, perf_path ? 1 : workers, perf_path ? 0 : isolate);
+    
+    if (getenv("BENCH_COMPARE")) {
+        print_test_stage("Differential benchmarks against libc");
+        run_libc_comparison();
+    }
+    
+    if (getenv("BENCH_ALIGN")) {
+        print_test_stage("Alignment and overlap matrix: ft_memcpy / ft_memmove");
+        run_align_matrix();
+    }
+    
+    if (getenv("BENCH_LATENCY")) {
+        print_test_stage("Per-call latency histograms");
+        run_latency_histograms();
+    }
+    
+    // Like baseline regressions, unexpected growth fails the run
+    int complexity_mismatches = 0;
+    if (getenv("BENCH_ADVERSARIAL")) {
+        print_test_stage("Adversarial inputs: ft_strnstr worst case");
+        complexity_mismatches += run_strnstr_adversarial();
+    }
+    
+    if (getenv("BENCH_COMPLEXITY")) {
+        print_test_stage("Complexity classes: fitted growth per function");
+        complexity_mismatches += run_complexity_detection();
+    }
+    
+    if (getenv("BENCH_LIST")) {
+        print_test_stage("List scaling: t_list from 10^3 nodes upward");
+        run_list_scaling();
+    }
+    
+    if (getenv("BENCH_LIST_LOCALITY")) {
+        print_test_stage("List locality: traversal by node placement");
+        run_list_locality();
+    }
+    
+    if (getenv("BENCH_THREADS")) {
+        print_test_stage("Thread scaling: concurrent calls from 1 thread upward");
+        run_thread_scaling();
+    }
+    
+    if (getenv("BENCH_SWEEP")) {
+        print_test_stage("Size sweep: mem* throughput from 1 B upward");
+        run_mem_size_sweep();
+    }
+    
+    if (perf_path) {
+        print_test_stage(perf_checking ? "Checking against performance baseline" : "Recording performance baseline");
+    }
+    int regressions = perf_finish();
+    bench_release();
+    
+    print_section_header("Test Summary");
+    if (Unity.TestFailures == 0 && regressions == 0 && complexity_mismatches == 0)
+        printf("\033[1;32mAll tests completed successfully!\033[0m\n");
+    else
+        printf("\033[1;31m%d test failure(s), %d performance regression(s), %d complexity mismatch(es)\033[0m\n",
+               (int)Unity.TestFailures, regressions, complexity_mismatches);
+    
+    return UNITY_END() + regressions + complexity_mismatches;
+} 
@@ -0,0 +1,177 @@
+#include "test_libft.h"
+
+const char test_memory_file[] = __FILE__;
+
+// Memory functions tests
+void test_memset(void) {
+    char str[10] = "Hello";
+    void *result = ft_memset(str, 'A', 5);
+    TEST_ASSERT_EQUAL_STRING("AAAAA", str);
+    TEST_ASSERT_EQUAL_PTR(str, result);
+    
+    // Test with zero length
+    char str2[10] = "Hello";
+    result = ft_memset(str2, 'A', 0);
+    TEST_ASSERT_EQUAL_STRING("Hello", str2);
+}
+
+void test_bzero(void) {
+    char str[10] = "Hello";
+    ft_bzero(str, 5);
+    TEST_ASSERT_EQUAL(0, str[0]);
+    TEST_ASSERT_EQUAL(0, str[4]);
+    
+    // Test with zero length
+    char str2[10] = "Hello";
+    ft_bzero(str2, 0);
+    TEST_ASSERT_EQUAL_STRING("Hello", str2);
+}
+
+void test_memcpy(void) {
+    char src[] = "Hello";
+    char dest[10];
+    void *result = ft_memcpy(dest, src, 6);
+    TEST_ASSERT_EQUAL_STRING("Hello", dest);
+    TEST_ASSERT_EQUAL_PTR(dest, result);
+    
+    // Test with zero length
+    char dest2[10] = "World";
+    result = ft_memcpy(dest2, src, 0);
+    TEST_ASSERT_EQUAL_STRING("World", dest2);
+}
+
+void test_memmove(void) {
+    char str[] = "Hello";
+    void *result = ft_memmove(str + 1, str, 4);
+    TEST_ASSERT_EQUAL_STRING("HHell", str);
+    TEST_ASSERT_EQUAL_PTR(str + 1, result);
+    
+    // Test with zero length
+    char str2[] = "Hello";
+    result = ft_memmove(str2 + 1, str2, 0);
+    TEST_ASSERT_EQUAL_STRING("Hello", str2);
+}
+
+// Alignment and overlap matrices for ft_memcpy / ft_memmove
+#define ALIGN_CHECK_LEN_MAX 257
+#define ALIGN_CHECK_SPAN (ALIGN_MAX_OFFSET + ALIGN_CHECK_LEN_MAX + ALIGN_MAX_OFFSET)
+#define ALIGN_FILL 0xA5
+
+static const size_t align_check_lengths[] = {0, 1, 7, 8, 15, 16, 31, 63, 64, 65, 257};
+const size_t overlap_distances[OVERLAP_DISTANCE_COUNT] = {1, 2, 3, 4, 7, 8, 15, 16, 31, 32, 63, 64, 255, 256};
+
+// Helper function to check that n bytes all hold value
+static int bytes_all_equal(const unsigned char *p, size_t n, unsigned char value) {
+    for (size_t i = 0; i < n; i++) {
+        if (p[i] != value)
+            return 0;
+    }
+    return 1;
+}
+
+void test_memcpy_alignment(void) {
+    _Alignas(64) static unsigned char src[ALIGN_CHECK_SPAN];
+    _Alignas(64) static unsigned char dst[ALIGN_CHECK_SPAN];
+    char msg[96];
+
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (unsigned char)(i * 7 + 1);
+    }
+    for (size_t s_off = 0; s_off < ALIGN_MAX_OFFSET; s_off++) {
+        for (size_t d_off = 0; d_off < ALIGN_MAX_OFFSET; d_off++) {
+            for (size_t l = 0; l < sizeof(align_check_lengths) / sizeof(*align_check_lengths); l++) {
+                size_t len = align_check_lengths[l];
+                void *result;
+
+                memset(dst, ALIGN_FILL, sizeof(dst));
+                result = ft_memcpy(dst + d_off, src + s_off, len);
+                if (result != dst + d_off
+                    || memcmp(dst + d_off, src + s_off, len) != 0
+                    || !bytes_all_equal(dst, d_off, ALIGN_FILL)
+                    || !bytes_all_equal(dst + d_off + len, sizeof(dst) - d_off - len, ALIGN_FILL)) {
+                    snprintf(msg, sizeof(msg), "ft_memcpy src+%zu dst+%zu len %zu", s_off, d_off, len);
+                    TEST_FAIL_MESSAGE(msg);
+                }
+            }
+        }
+    }
+}
+
+void test_memmove_alignment(void) {
+    _Alignas(64) static unsigned char src[ALIGN_CHECK_SPAN];
+    _Alignas(64) static unsigned char dst[ALIGN_CHECK_SPAN];
+    char msg[96];
+
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (unsigned char)(i * 13 + 5);
+    }
+    for (size_t s_off = 0; s_off < ALIGN_MAX_OFFSET; s_off++) {
+        for (size_t d_off = 0; d_off < ALIGN_MAX_OFFSET; d_off++) {
+            for (size_t l = 0; l < sizeof(align_check_lengths) / sizeof(*align_check_lengths); l++) {
+                size_t len = align_check_lengths[l];
+                void *result;
+
+                memset(dst, ALIGN_FILL, sizeof(dst));
+                result = ft_memmove(dst + d_off, src + s_off, len);
+                if (result != dst + d_off
+                    || memcmp(dst + d_off, src + s_off, len) != 0
+                    || !bytes_all_equal(dst, d_off, ALIGN_FILL)
+                    || !bytes_all_equal(dst + d_off + len, sizeof(dst) - d_off - len, ALIGN_FILL)) {
+                    snprintf(msg, sizeof(msg), "ft_memmove src+%zu dst+%zu len %zu", s_off, d_off, len);
+                    TEST_FAIL_MESSAGE(msg);
+                }
+            }
+        }
+    }
+}
+
+// Overlapping moves in both directions, checked against libc memmove on a
+// copy of the same buffer so guard bytes are verified too
+void test_memmove_overlap(void) {
+    _Alignas(64) static unsigned char buf[ALIGN_CHECK_SPAN + 256];
+    _Alignas(64) static unsigned char ref[ALIGN_CHECK_SPAN + 256];
+    char msg[128];
+
+    for (size_t d = 0; d < sizeof(overlap_distances) / sizeof(*overlap_distances); d++) {
+        size_t dist = overlap_distances[d];
+        for (size_t l = 0; l < sizeof(align_check_lengths) / sizeof(*align_check_lengths); l++) {
+            size_t len = align_check_lengths[l];
+            for (size_t base = 0; base < 8; base++) {
+                for (int backward = 0; backward <= 1; backward++) {
+                    size_t lo = ALIGN_MAX_OFFSET + base;
+                    size_t dst_off = backward ? lo : lo + dist;
+                    size_t src_off = backward ? lo + dist : lo;
+                    void *result;
+
+                    for (size_t i = 0; i < sizeof(buf); i++) {
+                        buf[i] = (unsigned char)(i * 31 + dist);
+                    }
+                    memcpy(ref, buf, sizeof(buf));
+                    memmove(ref + dst_off, ref + src_off, len);
+                    result = ft_memmove(buf + dst_off, buf + src_off, len);
+                    if (result != buf + dst_off || memcmp(buf, ref, sizeof(buf)) != 0) {
+                        snprintf(msg, sizeof(msg), "ft_memmove %s overlap dist %zu len %zu base+%zu",
+                                 backward ? "backward" : "forward", dist, len, base);
+                        TEST_FAIL_MESSAGE(msg);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void test_memchr(void) {
+    const char *str = "Hello";
+    TEST_ASSERT_EQUAL_STRING("ello", ft_memchr(str, 'e', 5));
+    TEST_ASSERT_EQUAL_STRING("o", ft_memchr(str, 'o', 5));
+    TEST_ASSERT_NULL(ft_memchr(str, 'x', 5));
+    TEST_ASSERT_NULL(ft_memchr(str, 'e', 0));
+}
+
+void test_memcmp(void) {
+    TEST_ASSERT_EQUAL(0, ft_memcmp("Hello", "Hello", 5));
+    TEST_ASSERT_EQUAL(0, ft_memcmp("Hello", "Hello", 3));
+    TEST_ASSERT(ft_memcmp("Hello", "World", 5) < 0);
+    TEST_ASSERT(ft_memcmp("World", "Hello", 5) > 0);
+    TEST_ASSERT_EQUAL(0, ft_memcmp("Hello", "World", 0));
+}
@@ -0,0 +1,368 @@
+#include "test_libft.h"
+
+const char test_properties_file[] = __FILE__;
+
+// Property-based tests. Random cases are generated for ft_split, ft_strtrim,
+// ft_substr and ft_strjoin and checked against invariants on PROP_THREADS
+// threads (default: one per CPU), PROP_CASES cases per property. Case i is
+// generated from the seed and i alone, and the lowest failing i is the one
+// reported, so PROP_SEED replays a run whatever the thread count. That case
+// is shrunk on the main thread, by deleting and simplifying characters and
+// lowering numbers while it still fails
+#define PROP_DEFAULT_CASES 200000
+#define PROP_MAX_THREADS 64
+#define PROP_MAX_LEN 64
+#define PROP_ALPHABET "ab ,-x"
+
+#define PROP_USES_T     0x1     // second string: trim set or join suffix
+#define PROP_USES_C     0x2     // split delimiter
+#define PROP_USES_RANGE 0x4     // substr start and len
+
+typedef struct s_prop_case {
+    char s[PROP_MAX_LEN + 1];
+    char t[PROP_MAX_LEN + 1];
+    char c;
+    size_t start;
+    size_t len;
+} t_prop_case;
+
+// A check returns 1 if the case holds, otherwise 0 with the reason in why
+typedef struct s_property {
+    const char *name;
+    int uses;
+    int (*check)(const t_prop_case *pc, char *why, size_t why_size);
+} t_property;
+
+typedef struct s_prop_run {
+    const t_property *prop;
+    size_t cases;
+    uint32_t seed;
+    size_t next;            // next case index, accessed atomically
+    size_t failed_at;       // lowest failing index, or cases; atomic
+    pthread_mutex_t lock;
+    t_prop_case failure;
+} t_prop_run;
+
+static uint32_t prop_rand(uint32_t *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+// Helper function to fill dst with a random string, biased towards short ones
+static void prop_gen_string(char *dst, size_t max_len, uint32_t *state) {
+    size_t len = prop_rand(state) % (prop_rand(state) % max_len + 1);
+
+    for (size_t i = 0; i < len; i++)
+        dst[i] = PROP_ALPHABET[prop_rand(state) % (sizeof(PROP_ALPHABET) - 1)];
+    dst[len] = '\0';
+}
+
+static void prop_generate(t_prop_case *pc, uint32_t *state) {
+    size_t slen;
+
+    prop_gen_string(pc->s, PROP_MAX_LEN + 1, state);
+    prop_gen_string(pc->t, prop_rand(state) % 2 ? 5 : PROP_MAX_LEN + 1, state);
+    pc->c = prop_rand(state) % 16 ? PROP_ALPHABET[prop_rand(state) % (sizeof(PROP_ALPHABET) - 1)] : '\0';
+    slen = strlen(pc->s);
+    pc->start = prop_rand(state) % (slen + 4);
+    pc->len = prop_rand(state) % 16 ? prop_rand(state) % (slen + 4) : SIZE_MAX;
+}
+
+// ft_split: pieces are non-empty, free of the delimiter, and concatenate to
+// the input with every delimiter removed
+static int prop_check_split(const t_prop_case *pc, char *why, size_t why_size) {
+    char expected[PROP_MAX_LEN + 1];
+    char joined[PROP_MAX_LEN + 1];
+    size_t expected_len = 0;
+    size_t joined_len = 0;
+    size_t words = 0;
+    size_t count;
+    char **parts;
+    int ok = 1;
+
+    for (size_t i = 0; pc->s[i]; i++) {
+        if (pc->s[i] == pc->c)
+            continue;
+        if (i == 0 || pc->s[i - 1] == pc->c)
+            words++;
+        expected[expected_len++] = pc->s[i];
+    }
+    expected[expected_len] = '\0';
+    parts = ft_split(pc->s, pc->c);
+    if (!parts) {
+        snprintf(why, why_size, "returned NULL");
+        return 0;
+    }
+    for (count = 0; parts[count]; count++) {
+        size_t len = strlen(parts[count]);
+
+        if (ok && len == 0) {
+            snprintf(why, why_size, "piece %zu is empty", count);
+            ok = 0;
+        } else if (ok && pc->c && strchr(parts[count], pc->c)) {
+            snprintf(why, why_size, "piece %zu \"%s\" contains the delimiter", count, parts[count]);
+            ok = 0;
+        } else if (ok && joined_len + len > expected_len) {
+            snprintf(why, why_size, "pieces are longer than the input without delimiters");
+            ok = 0;
+        } else if (ok) {
+            memcpy(joined + joined_len, parts[count], len);
+            joined_len += len;
+        }
+        free(parts[count]);
+    }
+    free(parts);
+    if (!ok)
+        return 0;
+    joined[joined_len] = '\0';
+    if (count != words) {
+        snprintf(why, why_size, "%zu pieces, expected %zu", count, words);
+        return 0;
+    }
+    if (strcmp(joined, expected) != 0) {
+        snprintf(why, why_size, "pieces join to \"%s\", expected \"%s\"", joined, expected);
+        return 0;
+    }
+    return 1;
+}
+
+// ft_strtrim: the result is the input with the longest prefix and suffix of
+// set characters removed
+static int prop_check_strtrim(const t_prop_case *pc, char *why, size_t why_size) {
+    size_t begin = 0;
+    size_t end = strlen(pc->s);
+    char *result;
+    int ok;
+
+    while (pc->s[begin] && strchr(pc->t, pc->s[begin]))
+        begin++;
+    while (end > begin && strchr(pc->t, pc->s[end - 1]))
+        end--;
+    result = ft_strtrim(pc->s, pc->t);
+    if (!result) {
+        snprintf(why, why_size, "returned NULL");
+        return 0;
+    }
+    ok = strlen(result) == end - begin && memcmp(result, pc->s + begin, end - begin) == 0;
+    if (!ok)
+        snprintf(why, why_size, "got \"%s\", expected \"%.*s\"", result, (int)(end - begin), pc->s + begin);
+    free(result);
+    return ok;
+}
+
+// ft_substr: at most len characters from start, empty once start is past
+// the end, never reading beyond the terminator
+static int prop_check_substr(const t_prop_case *pc, char *why, size_t why_size) {
+    size_t slen = strlen(pc->s);
+    size_t n = 0;
+    char *result;
+    int ok;
+
+    if (pc->start < slen)
+        n = pc->len < slen - pc->start ? pc->len : slen - pc->start;
+    result = ft_substr(pc->s, (unsigned int)pc->start, pc->len);
+    if (!result) {
+        snprintf(why, why_size, "returned NULL");
+        return 0;
+    }
+    ok = strlen(result) == n && memcmp(result, pc->s + (n ? pc->start : 0), n) == 0;
+    if (!ok)
+        snprintf(why, why_size, "got \"%s\", expected \"%.*s\"", result, (int)n, pc->s + (n ? pc->start : 0));
+    free(result);
+    return ok;
+}
+
+// ft_strjoin: the result is s followed by t
+static int prop_check_strjoin(const t_prop_case *pc, char *why, size_t why_size) {
+    size_t slen = strlen(pc->s);
+    size_t tlen = strlen(pc->t);
+    char *result = ft_strjoin(pc->s, pc->t);
+    int ok;
+
+    if (!result) {
+        snprintf(why, why_size, "returned NULL");
+        return 0;
+    }
+    ok = strlen(result) == slen + tlen && memcmp(result, pc->s, slen) == 0
+        && memcmp(result + slen, pc->t, tlen) == 0;
+    if (!ok)
+        snprintf(why, why_size, "got \"%s\", expected \"%s%s\"", result, pc->s, pc->t);
+    free(result);
+    return ok;
+}
+
+// Helper function to derive the generator state of case index from the seed
+// (splitmix32-style mixing, never zero)
+static uint32_t prop_case_state(uint32_t seed, size_t index) {
+    uint32_t x = seed ^ (uint32_t)index * 0x9E3779B9u ^ (uint32_t)((uint64_t)index >> 32);
+
+    x = (x ^ (x >> 16)) * 0x85EBCA6Bu;
+    x = (x ^ (x >> 13)) * 0xC2B2AE35u;
+    return (x ^ (x >> 16)) | 1;
+}
+
+// Workers take case indices from a shared counter. After a failure they
+// still run every index below it, so the lowest failing case is found
+static void *prop_worker(void *arg) {
+    t_prop_run *run = arg;
+    t_prop_case pc;
+    char why[256];
+
+    for (;;) {
+        size_t index = __atomic_fetch_add(&run->next, 1, __ATOMIC_RELAXED);
+        uint32_t state = prop_case_state(run->seed, index);
+
+        if (index >= __atomic_load_n(&run->failed_at, __ATOMIC_RELAXED))
+            break;
+        prop_generate(&pc, &state);
+        if (!run->prop->check(&pc, why, sizeof(why))) {
+            pthread_mutex_lock(&run->lock);
+            if (index < run->failed_at) {
+                run->failure = pc;
+                __atomic_store_n(&run->failed_at, index, __ATOMIC_RELAXED);
+            }
+            pthread_mutex_unlock(&run->lock);
+        }
+    }
+    return NULL;
+}
+
+// Helper function to try a shrunk candidate; keeps it if it still fails
+static int prop_try(const t_property *prop, t_prop_case *best, const t_prop_case *candidate) {
+    char why[256];
+
+    if (prop->check(candidate, why, sizeof(why)))
+        return 0;
+    *best = *candidate;
+    return 1;
+}
+
+// Helper function for one shrinking pass over a string field
+static int prop_shrink_string(const t_property *prop, t_prop_case *best, size_t offset) {
+    t_prop_case candidate;
+    int progress = 0;
+
+    for (size_t i = 0; ((char *)best + offset)[i]; ) {
+        char *str = (char *)&candidate + offset;
+
+        candidate = *best;
+        memmove(str + i, str + i + 1, strlen(str + i));
+        if (prop_try(prop, best, &candidate)) {
+            progress = 1;
+            continue;
+        }
+        candidate = *best;
+        if (str[i] != 'a') {
+            str[i] = 'a';
+            progress |= prop_try(prop, best, &candidate);
+        }
+        i++;
+    }
+    return progress;
+}
+
+// Helper function for one shrinking pass over a number field
+static int prop_shrink_number(const t_property *prop, t_prop_case *best, size_t offset) {
+    size_t value = *(size_t *)((char *)best + offset);
+    const size_t smaller[] = {0, value / 2, value - 1};
+    t_prop_case candidate;
+
+    for (size_t i = 0; i < sizeof(smaller) / sizeof(*smaller); i++) {
+        if (value == 0 || smaller[i] >= value)
+            continue;
+        candidate = *best;
+        *(size_t *)((char *)&candidate + offset) = smaller[i];
+        if (prop_try(prop, best, &candidate))
+            return 1;
+    }
+    return 0;
+}
+
+// Shrink to a case where no single deletion, simplification or decrement
+// still fails
+static void prop_shrink(const t_property *prop, t_prop_case *pc) {
+    int progress = 1;
+
+    while (progress) {
+        progress = prop_shrink_string(prop, pc, offsetof(t_prop_case, s));
+        if (prop->uses & PROP_USES_T)
+            progress |= prop_shrink_string(prop, pc, offsetof(t_prop_case, t));
+        if (prop->uses & PROP_USES_RANGE) {
+            progress |= prop_shrink_number(prop, pc, offsetof(t_prop_case, start));
+            progress |= prop_shrink_number(prop, pc, offsetof(t_prop_case, len));
+        }
+    }
+}
+
+// Helper function to describe a case with only the fields the property uses
+static void prop_describe(const t_property *prop, const t_prop_case *pc, char *buf, size_t size) {
+    int len = snprintf(buf, size, "s=\"%s\"", pc->s);
+
+    if ((prop->uses & PROP_USES_T) && len >= 0 && (size_t)len < size)
+        len += snprintf(buf + len, size - len, " t=\"%s\"", pc->t);
+    if ((prop->uses & PROP_USES_C) && len >= 0 && (size_t)len < size)
+        len += snprintf(buf + len, size - len, pc->c ? " c='%c'" : " c='\\0'", pc->c);
+    if ((prop->uses & PROP_USES_RANGE) && len >= 0 && (size_t)len < size)
+        snprintf(buf + len, size - len, " start=%zu len=%zu", pc->start, pc->len);
+}
+
+static void prop_run(const t_property *prop) {
+    pthread_t threads[PROP_MAX_THREADS];
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t nthreads = bench_env_size("PROP_THREADS", cpus > 0 ? (size_t)cpus : 1);
+    int started[PROP_MAX_THREADS];
+    t_prop_run run;
+    char why[256];
+    char desc[256];
+    static char msg[640];
+
+    if (nthreads > PROP_MAX_THREADS)
+        nthreads = PROP_MAX_THREADS;
+    memset(&run, 0, sizeof(run));
+    run.prop = prop;
+    run.cases = bench_env_size("PROP_CASES", PROP_DEFAULT_CASES);
+    run.failed_at = run.cases;
+    run.seed = (uint32_t)bench_env_size("PROP_SEED", (size_t)time(NULL) ^ (size_t)getpid());
+    pthread_mutex_init(&run.lock, NULL);
+    // The main thread is worker 0; if a thread cannot be created, the others
+    // simply take more of the cases
+    for (size_t i = 1; i < nthreads; i++)
+        started[i] = pthread_create(&threads[i], NULL, prop_worker, &run) == 0;
+    prop_worker(&run);
+    for (size_t i = 1; i < nthreads; i++) {
+        if (started[i])
+            pthread_join(threads[i], NULL);
+    }
+    pthread_mutex_destroy(&run.lock);
+    if (run.failed_at == run.cases)
+        return;
+
+    prop_shrink(prop, &run.failure);
+    prop->check(&run.failure, why, sizeof(why));
+    prop_describe(prop, &run.failure, desc, sizeof(desc));
+    snprintf(msg, sizeof(msg), "%s property failed at case %zu (PROP_SEED=%u): %s; minimal case %s",
+             prop->name, run.failed_at + 1, run.seed, why, desc);
+    TEST_FAIL_MESSAGE(msg);
+}
+
+void test_split_properties(void) {
+    static const t_property prop = {"ft_split", PROP_USES_C, prop_check_split};
+    prop_run(&prop);
+}
+
+void test_strtrim_properties(void) {
+    static const t_property prop = {"ft_strtrim", PROP_USES_T, prop_check_strtrim};
+    prop_run(&prop);
+}
+
+void test_substr_properties(void) {
+    static const t_property prop = {"ft_substr", PROP_USES_RANGE, prop_check_substr};
+    prop_run(&prop);
+}
+
+void test_strjoin_properties(void) {
+    static const t_property prop = {"ft_strjoin", PROP_USES_T, prop_check_strjoin};
+    prop_run(&prop);
+}
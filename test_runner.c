@@ -0,0 +1,396 @@
+#include "test_libft.h"
+
+// Job runner for the test and benchmark tables in test_main.c: rows run
+// in-process, on a pool of forked workers, or one forked child per job
+
+// Everything a worker sends back for one job
+typedef struct s_job_record {
+    size_t index;
+    UNITY_COUNTER_TYPE tests;
+    UNITY_COUNTER_TYPE failures;
+    UNITY_COUNTER_TYPE ignores;
+    int has_profile;
+    t_alloc_profile profile;
+    size_t leak_bytes;
+    size_t leak_blocks;
+    size_t leak_tests;
+    size_t output_len;
+} t_job_record;
+
+// UnityDefaultTestRun() with the test body run under the module's file, so
+// an assertion's __LINE__ is reported against the file it is in. The pass
+// line, tearDown() failures and crash reports keep the table file and row
+static void run_test(const t_job *job) {
+    const char *table_file = Unity.TestFile;
+
+    Unity.CurrentTestName = job->name;
+    Unity.CurrentTestLineNumber = (UNITY_LINE_TYPE)job->line;
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    if (TEST_PROTECT()) {
+        UnitySetTestFile(job->file ? job->file : table_file);
+        setUp();
+        job->test();
+    }
+    UnitySetTestFile(table_file);
+    if (TEST_PROTECT())
+        tearDown();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+static void run_job(const t_job *job) {
+    if (job->test)
+        run_test(job);
+    else
+        run_performance_test(job->name, job->size, job->kernel);
+}
+
+#define TEST_DEFAULT_TIMEOUT 10
+
+// Helper function to resolve TEST_JOBS: unset/1 = serial, 0 = one per core
+int test_worker_count(void) {
+    const char *env = getenv("TEST_JOBS");
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    long jobs;
+
+    if (!env || !*env)
+        return 1;
+    jobs = strtol(env, NULL, 10);
+    if (jobs <= 0)
+        jobs = cpus > 0 ? cpus : 1;
+    return (int)jobs;
+}
+
+#define SYMBOL_SEPARATORS " ,\t\n"
+
+// Helper function to check whether a separator-delimited list contains word
+static int list_has_word(const char *list, const char *word, size_t len) {
+    while (*list) {
+        size_t span;
+
+        list += strspn(list, SYMBOL_SEPARATORS);
+        span = strcspn(list, SYMBOL_SEPARATORS);
+        if (span == len && strncmp(list, word, len) == 0)
+            return 1;
+        list += span;
+    }
+    return 0;
+}
+
+// Helper function to check whether a job exercises one of the ft_ symbols in
+// the list. Rows without an explicit uses string match by name, so
+// test_strjoin, test_strjoin_properties and bench_strjoin all select ft_strjoin
+static int job_uses_symbol(const t_job *job, const char *symbols) {
+    const char *name = job->name;
+
+    if (strncmp(name, "test_", 5) == 0)
+        name += 5;
+    while (*symbols) {
+        const char *symbol;
+        size_t len;
+
+        symbols += strspn(symbols, SYMBOL_SEPARATORS);
+        len = strcspn(symbols, SYMBOL_SEPARATORS);
+        symbol = symbols;
+        symbols += len;
+        if (len == 0)
+            continue;
+        if (job->uses) {
+            if (list_has_word(job->uses, symbol, len))
+                return 1;
+            continue;
+        }
+        if (len > 3 && strncmp(symbol, "ft_", 3) == 0) {
+            symbol += 3;
+            len -= 3;
+        }
+        if (strncmp(name, symbol, len) == 0 && (name[len] == '\0' || name[len] == '_'))
+            return 1;
+    }
+    return 0;
+}
+
+// Copy the rows that exercise one of the ft_ symbols in TEST_SYMBOLS into
+// out, keeping a stage header only when one of its rows survives. A NULL or
+// empty symbol list keeps every row. Returns the number of rows copied
+size_t filter_jobs(const t_job *jobs, size_t count, const char *symbols, t_job *out) {
+    const t_job *stage = NULL;
+    size_t kept = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        if (!symbols || !*symbols) {
+            out[kept++] = jobs[i];
+        } else if (jobs[i].stage) {
+            stage = &jobs[i];
+        } else if (job_uses_symbol(&jobs[i], symbols)) {
+            if (stage)
+                out[kept++] = *stage;
+            stage = NULL;
+            out[kept++] = jobs[i];
+        }
+    }
+    return kept;
+}
+
+// Run one job with stdout already redirected to a scratch file, then append
+// a record plus the captured output to result_fd
+static void execute_job(const t_job *jobs, size_t index, int result_fd) {
+    t_job_record record;
+    UNITY_COUNTER_TYPE tests = Unity.NumberOfTests;
+    UNITY_COUNTER_TYPE failures = Unity.TestFailures;
+    UNITY_COUNTER_TYPE ignores = Unity.TestIgnores;
+    size_t profiles = alloc_test_count;
+    char buf[4096];
+    ssize_t n;
+
+    memset(&record, 0, sizeof(record));
+#ifdef ALLOC_TRACE
+    record.leak_bytes = leak_total_bytes;
+    record.leak_blocks = leak_total_blocks;
+    record.leak_tests = leak_tests;
+#endif
+    fflush(stdout);
+    ftruncate(STDOUT_FILENO, 0);
+    lseek(STDOUT_FILENO, 0, SEEK_SET);
+    run_job(&jobs[index]);
+    fflush(stdout);
+
+    record.index = index;
+    record.tests = Unity.NumberOfTests - tests;
+    record.failures = Unity.TestFailures - failures;
+    record.ignores = Unity.TestIgnores - ignores;
+    if (alloc_test_count > profiles) {
+        record.has_profile = 1;
+        record.profile = alloc_test_profiles[alloc_test_count - 1].profile;
+    }
+#ifdef ALLOC_TRACE
+    record.leak_bytes = leak_total_bytes - record.leak_bytes;
+    record.leak_blocks = leak_total_blocks - record.leak_blocks;
+    record.leak_tests = leak_tests - record.leak_tests;
+#endif
+    record.output_len = (size_t)lseek(STDOUT_FILENO, 0, SEEK_CUR);
+    write(result_fd, &record, sizeof(record));
+    lseek(STDOUT_FILENO, 0, SEEK_SET);
+    while ((n = read(STDOUT_FILENO, buf, sizeof(buf))) > 0)
+        write(result_fd, buf, (size_t)n);
+}
+
+// Fork-server step: run one job in a child forked from the already
+// initialized process. A child that crashes or exceeds TEST_TIMEOUT seconds
+// becomes a failure record carrying whatever output it produced
+static void execute_job_isolated(const t_job *jobs, size_t index, int result_fd, unsigned timeout) {
+    FILE *child_result = tmpfile();
+    t_job_record record;
+    char buf[4096];
+    char reason[128];
+    int status = 0;
+    pid_t pid;
+    off_t end;
+    ssize_t n;
+
+    if (!child_result) {
+        execute_job(jobs, index, result_fd);
+        return;
+    }
+    fflush(stdout);
+    pid = fork();
+    if (pid == 0) {
+        // Unbuffered, so output printed before a crash reaches the scratch file
+        setvbuf(stdout, NULL, _IONBF, 0);
+        alarm(timeout);
+        execute_job(jobs, index, fileno(child_result));
+        _exit(0);
+    }
+    if (pid > 0)
+        waitpid(pid, &status, 0);
+    if (pid > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+        rewind(child_result);
+        while ((n = (ssize_t)fread(buf, 1, sizeof(buf), child_result)) > 0)
+            write(result_fd, buf, (size_t)n);
+        fclose(child_result);
+        return;
+    }
+    fclose(child_result);
+
+    if (pid < 0)
+        snprintf(reason, sizeof(reason), "fork failed");
+    else if (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM)
+        snprintf(reason, sizeof(reason), "timed out after %u s", timeout);
+    else if (WIFSIGNALED(status))
+        snprintf(reason, sizeof(reason), "crashed with signal %d (%s)", WTERMSIG(status), strsignal(WTERMSIG(status)));
+    else
+        snprintf(reason, sizeof(reason), "exited with status %d", WEXITSTATUS(status));
+    // The child's partial output is still in the shared scratch file; the
+    // line refers to the job table, which Unity reports under its test file
+    end = lseek(STDOUT_FILENO, 0, SEEK_END);
+    if (end <= 0 || pread(STDOUT_FILENO, buf, 1, end - 1) != 1)
+        buf[0] = '\n';
+    dprintf(STDOUT_FILENO, "%s%s:%d:%s:FAIL: %s\n", buf[0] != '\n' ? "\n" : "",
+            Unity.TestFile, jobs[index].line, jobs[index].name, reason);
+    memset(&record, 0, sizeof(record));
+    record.index = index;
+    record.tests = jobs[index].test != NULL;
+    record.failures = 1;
+    record.output_len = (size_t)lseek(STDOUT_FILENO, 0, SEEK_CUR);
+    write(result_fd, &record, sizeof(record));
+    lseek(STDOUT_FILENO, 0, SEEK_SET);
+    while ((n = read(STDOUT_FILENO, buf, sizeof(buf))) > 0)
+        write(result_fd, buf, (size_t)n);
+}
+
+// Worker loop: pull job indices from the shared task pipe and run each,
+// in-process or in a forked child when isolate is set
+static void job_worker(const t_job *jobs, int task_fd, int result_fd, int cpu, int isolate) {
+    FILE *scratch = tmpfile();
+    unsigned timeout = (unsigned)bench_env_size("TEST_TIMEOUT", TEST_DEFAULT_TIMEOUT);
+    size_t index;
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    sched_setaffinity(0, sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+    if (!scratch)
+        _exit(1);
+    // Counters opened by the parent measure the parent; reopen per worker
+    if (bench_counters_state > 0)
+        bench_counters_close();
+    dup2(fileno(scratch), STDOUT_FILENO);
+    while (read(task_fd, &index, sizeof(index)) == (ssize_t)sizeof(index)) {
+        if (isolate)
+            execute_job_isolated(jobs, index, result_fd, timeout);
+        else
+            execute_job(jobs, index, result_fd);
+    }
+    _exit(0);
+}
+
+// Helper function to fold a worker's record into the parent's Unity state
+static void merge_job_record(const t_job *job, const t_job_record *record) {
+    Unity.NumberOfTests += record->tests;
+    Unity.TestFailures += record->failures;
+    Unity.TestIgnores += record->ignores;
+    if (record->has_profile && alloc_test_count < ALLOC_MAX_TESTS) {
+        alloc_test_profiles[alloc_test_count].name = job->name;
+        alloc_test_profiles[alloc_test_count].profile = record->profile;
+        alloc_test_count++;
+    }
+#ifdef ALLOC_TRACE
+    leak_total_bytes += record->leak_bytes;
+    leak_total_blocks += record->leak_blocks;
+    leak_tests += record->leak_tests;
+#endif
+}
+
+// Run every row of jobs, on `workers` processes when workers > 1, and with
+// one forked child per job when isolate is set. Output is replayed in table
+// order and Unity counters are merged, so UnityEnd() prints one summary
+void run_jobs(const t_job *jobs, size_t count, int workers, int isolate) {
+    t_job_record *records;
+    char **outputs;
+    FILE **result_files;
+    int task_pipe[2];
+    size_t runnable = 0;
+    int started = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        runnable += jobs[i].stage == NULL;
+    }
+    if ((size_t)workers > runnable)
+        workers = (int)runnable;
+    if (workers < 1)
+        workers = 1;
+    if (workers == 1 && !isolate) {
+        for (size_t i = 0; i < count; i++) {
+            if (jobs[i].stage)
+                print_test_stage(jobs[i].stage);
+            else
+                run_job(&jobs[i]);
+        }
+        return;
+    }
+
+    records = calloc(count, sizeof(*records));
+    outputs = calloc(count, sizeof(*outputs));
+    result_files = calloc((size_t)workers, sizeof(*result_files));
+    if (!records || !outputs || !result_files || pipe(task_pipe) != 0) {
+        free(records);
+        free(outputs);
+        free(result_files);
+        run_jobs(jobs, count, 1, 0);
+        return;
+    }
+    fflush(stdout);
+    for (int w = 0; w < workers; w++) {
+        pid_t pid;
+
+        result_files[w] = tmpfile();
+        if (!result_files[w])
+            continue;
+        pid = fork();
+        if (pid == 0) {
+            close(task_pipe[1]);
+            job_worker(jobs, task_pipe[0], fileno(result_files[w]), w, isolate);
+        }
+        started += pid > 0;
+    }
+    close(task_pipe[0]);
+    // Feed indices only once the workers are reading: a large table does
+    // not fit in the pipe buffer. Each read takes exactly one index. If
+    // every worker has died, write fails with EPIPE instead of blocking
+    signal(SIGPIPE, SIG_IGN);
+    for (size_t i = 0; i < count && started; i++) {
+        if (!jobs[i].stage && write(task_pipe[1], &i, sizeof(i)) != (ssize_t)sizeof(i))
+            break;
+    }
+    signal(SIGPIPE, SIG_DFL);
+    close(task_pipe[1]);
+    while (wait(NULL) > 0)
+        ;
+
+    for (int w = 0; w < workers; w++) {
+        t_job_record record;
+
+        if (!result_files[w])
+            continue;
+        rewind(result_files[w]);
+        while (fread(&record, sizeof(record), 1, result_files[w]) == 1) {
+            char *output = malloc(record.output_len + 1);
+
+            if (!output || fread(output, 1, record.output_len, result_files[w]) != record.output_len) {
+                free(output);
+                break;
+            }
+            records[record.index] = record;
+            outputs[record.index] = output;
+        }
+        fclose(result_files[w]);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (jobs[i].stage) {
+            print_test_stage(jobs[i].stage);
+        } else if (outputs[i]) {
+            fwrite(outputs[i], 1, records[i].output_len, stdout);
+            merge_job_record(&jobs[i], &records[i]);
+        } else {
+            // The worker died before reporting this job; reported like an
+            // isolated crash, at the job's row in the table
+            printf("%s:%d:%s:FAIL: worker exited before reporting a result\n",
+                   Unity.TestFile, jobs[i].line, jobs[i].name);
+            Unity.NumberOfTests += jobs[i].test != NULL;
+            Unity.TestFailures++;
+        }
+        free(outputs[i]);
+    }
+    fflush(stdout);
+    free(records);
+    free(outputs);
+    free(result_files);
+}
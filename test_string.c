@@ -0,0 +1,223 @@
+#include "test_libft.h"
+
+const char test_string_file[] = __FILE__;
+
+// String functions tests
+void test_strlen(void) {
+    TEST_ASSERT_EQUAL(0, ft_strlen(""));
+    TEST_ASSERT_EQUAL(5, ft_strlen("Hello"));
+    TEST_ASSERT_EQUAL(1, ft_strlen("A"));
+    TEST_ASSERT_EQUAL(100, ft_strlen("AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"));
+    TEST_ASSERT_EQUAL(5, ft_strlen("Hello"));
+}
+
+void test_strlcpy(void) {
+    char dest[10];
+    const char *src = "Hello";
+    size_t result = ft_strlcpy(dest, src, sizeof(dest));
+    TEST_ASSERT_EQUAL_STRING("Hello", dest);
+    TEST_ASSERT_EQUAL(5, result);
+    
+    // Test with zero size
+    TEST_ASSERT_EQUAL(5, ft_strlcpy(dest, src, 0));
+}
+
+void test_strlcat(void) {
+    char dest[20] = "Hello";
+    const char *src = "World";
+    size_t result = ft_strlcat(dest, src, sizeof(dest));
+    TEST_ASSERT_EQUAL_STRING("HelloWorld", dest);
+    TEST_ASSERT_EQUAL(10, result);
+    
+    // Test with zero size
+    TEST_ASSERT_EQUAL(5, ft_strlcat(dest, src, 0));
+}
+
+void test_strchr(void) {
+    const char *str = "Hello";
+    TEST_ASSERT_EQUAL_STRING("ello", ft_strchr(str, 'e'));
+    TEST_ASSERT_EQUAL_STRING("o", ft_strchr(str, 'o'));
+    TEST_ASSERT_NULL(ft_strchr(str, 'x'));
+    TEST_ASSERT_EQUAL_STRING("", ft_strchr(str, '\0'));
+}
+
+void test_strrchr(void) {
+    const char *str = "Hello";
+    TEST_ASSERT_EQUAL_STRING("ello", ft_strrchr(str, 'e'));
+    TEST_ASSERT_EQUAL_STRING("o", ft_strrchr(str, 'o'));
+    TEST_ASSERT_NULL(ft_strrchr(str, 'x'));
+    TEST_ASSERT_EQUAL_STRING("", ft_strrchr(str, '\0'));
+}
+
+void test_strncmp(void) {
+    TEST_ASSERT_EQUAL(0, ft_strncmp("Hello", "Hello", 5));
+    TEST_ASSERT_EQUAL(0, ft_strncmp("Hello", "Hello", 3));
+    TEST_ASSERT(ft_strncmp("Hello", "World", 5) < 0);
+    TEST_ASSERT(ft_strncmp("World", "Hello", 5) > 0);
+    TEST_ASSERT_EQUAL(0, ft_strncmp("Hello", "World", 0));
+}
+
+void test_strnstr(void) {
+    const char *big = "Hello World";
+    TEST_ASSERT_EQUAL_STRING("World", ft_strnstr(big, "World", 11));
+    TEST_ASSERT_EQUAL_STRING("World", ft_strnstr(big, "World", 20));
+    TEST_ASSERT_NULL(ft_strnstr(big, "World", 5));
+    TEST_ASSERT_EQUAL_STRING("Hello World", ft_strnstr(big, "", 11));
+}
+
+void test_atoi(void) {
+    TEST_ASSERT_EQUAL(0, ft_atoi("0"));
+    TEST_ASSERT_EQUAL(42, ft_atoi("42"));
+    TEST_ASSERT_EQUAL(-42, ft_atoi("-42"));
+    TEST_ASSERT_EQUAL(42, ft_atoi("+42"));
+    TEST_ASSERT_EQUAL(0, ft_atoi(""));
+    TEST_ASSERT_EQUAL(0, ft_atoi("abc"));
+    TEST_ASSERT_EQUAL(2147483647, ft_atoi("2147483647"));
+    TEST_ASSERT_EQUAL(-2147483648, ft_atoi("-2147483648"));
+}
+
+void test_substr(void) {
+    const char *str = "Hello World";
+    char *sub = ft_substr(str, 6, 5);
+    TEST_ASSERT_EQUAL_STRING("World", sub);
+    free(sub);
+    
+    // Test with NULL
+    TEST_ASSERT_NULL(ft_substr(NULL, 0, 5));
+    
+    // Test with invalid start
+    sub = ft_substr(str, 20, 5);
+    TEST_ASSERT_EQUAL_STRING("", sub);
+    free(sub);
+    
+    // Test with zero length
+    sub = ft_substr(str, 0, 0);
+    TEST_ASSERT_EQUAL_STRING("", sub);
+    free(sub);
+}
+
+void test_strjoin(void) {
+    const char *s1 = "Hello";
+    const char *s2 = "World";
+    char *joined = ft_strjoin(s1, s2);
+    TEST_ASSERT_EQUAL_STRING("HelloWorld", joined);
+    free(joined);
+    
+    // Test with NULL
+    TEST_ASSERT_NULL(ft_strjoin(NULL, s2));
+    TEST_ASSERT_NULL(ft_strjoin(s1, NULL));
+    
+    // Test with empty strings
+    joined = ft_strjoin("", "");
+    TEST_ASSERT_EQUAL_STRING("", joined);
+    free(joined);
+}
+
+void test_strtrim(void) {
+    const char *str = "  Hello World  ";
+    const char *set = " ";
+    char *trimmed = ft_strtrim(str, set);
+    TEST_ASSERT_EQUAL_STRING("Hello World", trimmed);
+    free(trimmed);
+    
+    // Test with NULL
+    TEST_ASSERT_NULL(ft_strtrim(NULL, set));
+    TEST_ASSERT_NULL(ft_strtrim(str, NULL));
+    
+    // Test with empty string
+    trimmed = ft_strtrim("", set);
+    TEST_ASSERT_EQUAL_STRING("", trimmed);
+    free(trimmed);
+}
+
+void test_split(void) {
+    char **result;
+    
+    // Test with normal string
+    result = ft_split("Hello World", ' ');
+    TEST_ASSERT_NOT_NULL(result);
+    TEST_ASSERT_EQUAL_STRING("Hello", result[0]);
+    TEST_ASSERT_EQUAL_STRING("World", result[1]);
+    TEST_ASSERT_NULL(result[2]);
+    free(result[0]);
+    free(result[1]);
+    free(result);
+
+    // Test with empty string
+    result = ft_split("", ' ');
+    TEST_ASSERT_NOT_NULL(result);
+    TEST_ASSERT_NULL(result[0]);
+    free(result);
+
+    // Test with multiple delimiters
+    result = ft_split("Hello   World", ' ');
+    TEST_ASSERT_NOT_NULL(result);
+    TEST_ASSERT_EQUAL_STRING("Hello", result[0]);
+    TEST_ASSERT_EQUAL_STRING("World", result[1]);
+    TEST_ASSERT_NULL(result[2]);
+    free(result[0]);
+    free(result[1]);
+    free(result);
+
+    // Test with no delimiters
+    result = ft_split("HelloWorld", ' ');
+    TEST_ASSERT_NOT_NULL(result);
+    TEST_ASSERT_EQUAL_STRING("HelloWorld", result[0]);
+    TEST_ASSERT_NULL(result[1]);
+    free(result[0]);
+    free(result);
+
+    // Test with NULL string
+    result = ft_split(NULL, ' ');
+    TEST_ASSERT_NULL(result);
+}
+
+void test_itoa(void) {
+    char *str = ft_itoa(42);
+    TEST_ASSERT_EQUAL_STRING("42", str);
+    free(str);
+    
+    str = ft_itoa(-42);
+    TEST_ASSERT_EQUAL_STRING("-42", str);
+    free(str);
+    
+    str = ft_itoa(0);
+    TEST_ASSERT_EQUAL_STRING("0", str);
+    free(str);
+    
+    str = ft_itoa(2147483647);
+    TEST_ASSERT_EQUAL_STRING("2147483647", str);
+    free(str);
+    
+    str = ft_itoa(-2147483648);
+    TEST_ASSERT_EQUAL_STRING("-2147483648", str);
+    free(str);
+}
+
+char test_map(unsigned int i, char c) {
+    (void)i;
+    return c + 1;
+}
+
+void test_strmapi(void) {
+    const char *str = "Hello";
+    char *mapped = ft_strmapi(str, test_map);
+    TEST_ASSERT_EQUAL_STRING("Ifmmp", mapped);
+    free(mapped);
+    
+    // Test with empty string
+    mapped = ft_strmapi("", test_map);
+    TEST_ASSERT_EQUAL_STRING("", mapped);
+    free(mapped);
+}
+
+// Helper for test_striteri
+static void test_func(unsigned int i, char *c) {
+    *c = *c + i;
+}
+
+void test_striteri(void) {
+    char str[] = "Hello";
+    ft_striteri(str, test_func);
+    TEST_ASSERT_EQUAL_STRING("Hfnos", str);
+}
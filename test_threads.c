@@ -0,0 +1,296 @@
+#include "test_libft.h"
+
+const char test_threads_file[] = __FILE__;
+
+// Reentrancy and multi-threaded scaling. Every operation below checks its
+// result against an expectation computed without libft, on inputs unique to
+// its thread, so hidden static state (an ft_itoa returning a static buffer)
+// or a block handed to two threads shows up as a mismatch once several
+// threads call the same function. test_thread_reentrancy runs each operation
+// on THREAD_TEST_COUNT threads; BENCH_THREADS=1 measures throughput from one
+// thread up to BENCH_THREADS_MAX (default: CPUs, at least THREAD_TEST_COUNT)
+// for BENCH_THREADS_MS milliseconds per cell
+#define THREAD_TEST_COUNT 4
+#define THREAD_TEST_CALLS 2000
+#define THREAD_MAX 64
+#define THREAD_DEFAULT_MS 200
+#define THREAD_WORDS 8
+#define THREAD_TEXT_SIZE 128
+#define THREAD_LIST_LEN 32
+
+typedef struct s_thread_state {
+    uint32_t rng;
+    char text[THREAD_TEXT_SIZE];    // THREAD_WORDS words tagged with the thread id
+    size_t text_len;
+    int values[THREAD_LIST_LEN + 1];
+    t_list nodes[THREAD_LIST_LEN];  // ft_lstmap input, one per thread
+} t_thread_state;
+
+typedef struct s_thread_op {
+    const char *name;
+    int (*run)(t_thread_state *state);   // 0 when the result was correct
+} t_thread_op;
+
+static uint32_t thread_rand(t_thread_state *state) {
+    state->rng ^= state->rng << 13;
+    state->rng ^= state->rng >> 17;
+    state->rng ^= state->rng << 5;
+    return state->rng;
+}
+
+static void thread_init(t_thread_state *state, unsigned id) {
+    size_t len = 0;
+
+    state->rng = (uint32_t)(id + 1) * 0x9E3779B9u | 1;
+    // Two leading spaces and a double space give ft_split empty fields to skip
+    for (int w = 0; w < THREAD_WORDS; w++)
+        len += (size_t)snprintf(state->text + len, sizeof(state->text) - len,
+                                w == 0 || w == THREAD_WORDS / 2 ? "  t%uw%d" : " t%uw%d", id, w);
+    state->text_len = len;
+    for (int i = 0; i <= THREAD_LIST_LEN; i++)
+        state->values[i] = (int)(id * 1000) + i;
+    for (int i = 0; i < THREAD_LIST_LEN; i++) {
+        state->nodes[i].content = &state->values[i];
+        state->nodes[i].next = i + 1 < THREAD_LIST_LEN ? &state->nodes[i + 1] : NULL;
+    }
+}
+
+static int thread_itoa(t_thread_state *state) {
+    int value = (int)thread_rand(state);
+    char expected[16];
+    char *result = ft_itoa(value);
+    int bad;
+
+    snprintf(expected, sizeof(expected), "%d", value);
+    bad = !result || strcmp(result, expected) != 0;
+    free(result);
+    return bad;
+}
+
+static int thread_split(t_thread_state *state) {
+    char **words = ft_split(state->text, ' ');
+    const char *p = state->text;
+    int bad = !words;
+
+    for (int w = 0; !bad && w < THREAD_WORDS; w++) {
+        size_t len;
+
+        while (*p == ' ')
+            p++;
+        len = strcspn(p, " ");
+        bad = !words[w] || strlen(words[w]) != len || strncmp(words[w], p, len) != 0;
+        p += len;
+    }
+    if (!bad && words[THREAD_WORDS])
+        bad = 1;
+    for (size_t i = 0; words && words[i]; i++)
+        free(words[i]);
+    free(words);
+    return bad;
+}
+
+static int thread_strjoin(t_thread_state *state) {
+    size_t split = thread_rand(state) % (state->text_len + 1);
+    char *result = ft_strjoin(state->text + split, state->text);
+    size_t first = state->text_len - split;
+    int bad;
+
+    bad = !result || strlen(result) != first + state->text_len
+        || memcmp(result, state->text + split, first) != 0
+        || memcmp(result + first, state->text, state->text_len) != 0;
+    free(result);
+    return bad;
+}
+
+static int thread_strdup(t_thread_state *state) {
+    size_t start = thread_rand(state) % (state->text_len + 1);
+    char *result = ft_strdup(state->text + start);
+    int bad = !result || strcmp(result, state->text + start) != 0;
+
+    free(result);
+    return bad;
+}
+
+static int thread_substr(t_thread_state *state) {
+    unsigned int start = thread_rand(state) % (unsigned int)(state->text_len + 8);
+    size_t len = thread_rand(state) % (state->text_len + 8);
+    char *result = ft_substr(state->text, start, len);
+    size_t expected = 0;
+    int bad;
+
+    if (start < state->text_len)
+        expected = state->text_len - start < len ? state->text_len - start : len;
+    bad = !result || strlen(result) != expected
+        || (expected && memcmp(result, state->text + start, expected) != 0);
+    free(result);
+    return bad;
+}
+
+// Maps each node to the next value in the thread's array, without allocating
+static void *thread_next_value(void *content) {
+    return (int *)content + 1;
+}
+
+static void thread_keep(void *content) {
+    (void)content;
+}
+
+static int thread_lstmap(t_thread_state *state) {
+    t_list *mapped = ft_lstmap(state->nodes, thread_next_value, thread_keep);
+    t_list *node = mapped;
+    int bad = 0;
+
+    for (int i = 0; i < THREAD_LIST_LEN && !bad; i++) {
+        bad = !node || node->content != &state->values[i + 1];
+        if (node)
+            node = node->next;
+    }
+    if (node)
+        bad = 1;
+    ft_lstclear(&mapped, thread_keep);
+    return bad;
+}
+
+static const t_thread_op thread_ops[] = {
+    {"itoa", thread_itoa},
+    {"split", thread_split},
+    {"strjoin", thread_strjoin},
+    {"strdup", thread_strdup},
+    {"substr", thread_substr},
+    {"lstmap", thread_lstmap},
+};
+
+#define THREAD_OP_COUNT (sizeof(thread_ops) / sizeof(*thread_ops))
+
+// Shared by the threads of one run. Workers wait for go, then call the
+// operation until they reach calls or stop is raised
+typedef struct s_thread_run {
+    const t_thread_op *op;
+    size_t calls;
+    int go;
+    int stop;
+} t_thread_run;
+
+typedef struct s_thread_worker {
+    t_thread_run *run;
+    t_thread_state state;
+    size_t done;
+    size_t mismatches;
+} t_thread_worker;
+
+static uint64_t thread_now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void *thread_worker(void *arg) {
+    t_thread_worker *worker = arg;
+    t_thread_run *run = worker->run;
+
+    while (!__atomic_load_n(&run->go, __ATOMIC_ACQUIRE))
+        sched_yield();
+    while (worker->done < run->calls && !__atomic_load_n(&run->stop, __ATOMIC_RELAXED)) {
+        worker->mismatches += (size_t)run->op->run(&worker->state);
+        worker->done++;
+    }
+    return NULL;
+}
+
+// Helper function to run op on nthreads threads, either for a fixed number
+// of calls each or, with calls == 0, for about duration_ms. Without a thread
+// (creation failure) a worker's share runs inline after the others.
+// Returns the total number of calls, adds up mismatches, and stores the
+// measured time from go to the last join in elapsed_ns when non-NULL
+static size_t thread_run(const t_thread_op *op, size_t nthreads, size_t calls,
+                         unsigned duration_ms, size_t *mismatches, uint64_t *elapsed_ns) {
+    static t_thread_worker workers[THREAD_MAX];
+    pthread_t threads[THREAD_MAX];
+    int started[THREAD_MAX];
+    t_thread_run run = {op, calls ? calls : SIZE_MAX, 0, 0};
+    size_t total = 0;
+    uint64_t start;
+
+    for (size_t i = 0; i < nthreads; i++) {
+        workers[i].run = &run;
+        workers[i].done = 0;
+        workers[i].mismatches = 0;
+        thread_init(&workers[i].state, (unsigned)i);
+        started[i] = pthread_create(&threads[i], NULL, thread_worker, &workers[i]) == 0;
+    }
+    start = thread_now_ns();
+    __atomic_store_n(&run.go, 1, __ATOMIC_RELEASE);
+    if (!calls) {
+        struct timespec delay = {duration_ms / 1000, (long)(duration_ms % 1000) * 1000000L};
+
+        nanosleep(&delay, NULL);
+        __atomic_store_n(&run.stop, 1, __ATOMIC_RELAXED);
+    }
+    for (size_t i = 0; i < nthreads; i++) {
+        if (started[i])
+            pthread_join(threads[i], NULL);
+        else if (calls)
+            thread_worker(&workers[i]);
+        total += workers[i].done;
+        *mismatches += workers[i].mismatches;
+    }
+    if (elapsed_ns)
+        *elapsed_ns = thread_now_ns() - start;
+    return total;
+}
+
+void test_thread_reentrancy(void) {
+    static char msg[128];
+
+    for (size_t i = 0; i < THREAD_OP_COUNT; i++) {
+        size_t mismatches = 0;
+        size_t calls = thread_run(&thread_ops[i], THREAD_TEST_COUNT, THREAD_TEST_CALLS, 0, &mismatches, NULL);
+
+        snprintf(msg, sizeof(msg), "ft_%s: %zu of %zu concurrent calls returned a wrong result",
+                 thread_ops[i].name, mismatches, calls);
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(0, mismatches, msg);
+    }
+}
+
+void run_thread_scaling(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t max_threads = bench_env_size("BENCH_THREADS_MAX",
+                                        cpus > THREAD_TEST_COUNT ? (size_t)cpus : THREAD_TEST_COUNT);
+    unsigned duration_ms = (unsigned)bench_env_size("BENCH_THREADS_MS", THREAD_DEFAULT_MS);
+    size_t counts[THREAD_MAX];
+    size_t ncounts = 0;
+
+    if (max_threads > THREAD_MAX)
+        max_threads = THREAD_MAX;
+    // Powers of two, plus the maximum itself
+    for (size_t t = 1; t < max_threads; t *= 2)
+        counts[ncounts++] = t;
+    counts[ncounts++] = max_threads;
+
+    printf("  \033[1m%-8s", "threads");
+    for (size_t c = 0; c < ncounts; c++)
+        printf(" %15zu", counts[c]);
+    printf("\033[0m   (million calls/s, speedup over 1 thread; %ld CPUs)\n", cpus);
+    for (size_t i = 0; i < THREAD_OP_COUNT; i++) {
+        size_t mismatches = 0;
+        double single = 0.0;
+
+        printf("  \033[1;36m%-8s\033[0m", thread_ops[i].name);
+        for (size_t c = 0; c < ncounts; c++) {
+            uint64_t elapsed_ns;
+            size_t calls = thread_run(&thread_ops[i], counts[c], 0, duration_ms, &mismatches, &elapsed_ns);
+            // Measured time covers sleep overshoot, start-up and calls still
+            // running after stop, all of which grow with the thread count
+            double rate = elapsed_ns ? (double)calls * 1000.0 / (double)elapsed_ns : 0.0;
+
+            if (c == 0)
+                single = rate;
+            printf(" %8.2f %5.2fx", rate, single > 0 ? rate / single : 0.0);
+            fflush(stdout);
+        }
+        if (mismatches)
+            printf("  \033[1;31m%zu wrong results\033[0m", mismatches);
+        printf("\n");
+    }
+}
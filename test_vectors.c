@@ -0,0 +1,281 @@
+#include "test_libft.h"
+
+const char test_vectors_file[] = __FILE__;
+
+// Data-driven test vectors. Each ft_ function with a vector file is checked
+// against every record of vectors/<name>.txt (TEST_VECTORS overrides the
+// directory, e.g. to point at captured production inputs). Files are mapped
+// read-only and walked in place: one record per line, fields separated by
+// tabs, '#' starts a comment line. String fields accept \t \n \r \\ \0 and
+// \xHH escapes and are decoded into stack buffers, so no case allocates
+#define VECTOR_DEFAULT_DIR "vectors"
+#define VECTOR_MAX_FIELDS 4
+#define VECTOR_FIELD_MAX 4096
+#define VECTOR_BAD ((size_t)-1)
+
+typedef struct s_vector_field {
+    const char *ptr;
+    size_t len;
+} t_vector_field;
+
+typedef struct s_vector_file {
+    const char *name;
+    const char *data;
+    size_t size;
+    size_t pos;
+    size_t line;
+} t_vector_file;
+
+// Helper function to map a vector file; returns -1 if it is missing or empty
+static int vector_open(const char *name, t_vector_file *file) {
+    const char *dir = getenv("TEST_VECTORS");
+    char path[512];
+    struct stat st;
+    void *data;
+    int fd;
+
+    snprintf(path, sizeof(path), "%s/%s", dir ? dir : VECTOR_DEFAULT_DIR, name);
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return -1;
+    }
+    data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return -1;
+#ifdef MADV_SEQUENTIAL
+    madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+    file->name = name;
+    file->data = data;
+    file->size = (size_t)st.st_size;
+    file->pos = 0;
+    file->line = 0;
+    return 0;
+}
+
+static void vector_close(t_vector_file *file) {
+    munmap((void *)file->data, file->size);
+    file->data = NULL;
+}
+
+// Split the next record into fields; returns the field count, 0 at the end
+static int vector_next(t_vector_file *file, t_vector_field *fields, int max_fields) {
+    while (file->pos < file->size) {
+        const char *start = file->data + file->pos;
+        const char *end = memchr(start, '\n', file->size - file->pos);
+        int count = 0;
+
+        if (!end)
+            end = file->data + file->size;
+        file->pos = (size_t)(end - file->data) + 1;
+        file->line++;
+        if (end > start && end[-1] == '\r')
+            end--;
+        if (end == start || *start == '#')
+            continue;
+        while (count < max_fields) {
+            const char *tab = count + 1 < max_fields ? memchr(start, '\t', (size_t)(end - start)) : NULL;
+
+            fields[count].ptr = start;
+            fields[count].len = (size_t)((tab ? tab : end) - start);
+            count++;
+            if (!tab)
+                break;
+            start = tab + 1;
+        }
+        return count;
+    }
+    return 0;
+}
+
+// Helper function to decode hex digits; returns -1 for anything else
+static int vector_hex(char c) {
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// Decode a string field into out and NUL-terminate it; returns the decoded
+// length, or VECTOR_BAD if it does not fit or has a bad escape
+static size_t vector_string(const t_vector_field *field, char *out, size_t cap) {
+    size_t len = 0;
+
+    for (size_t i = 0; i < field->len; i++) {
+        char c = field->ptr[i];
+
+        if (c == '\\') {
+            if (++i >= field->len)
+                return VECTOR_BAD;
+            switch (field->ptr[i]) {
+            case 't': c = '\t'; break;
+            case 'n': c = '\n'; break;
+            case 'r': c = '\r'; break;
+            case '0': c = '\0'; break;
+            case '\\': c = '\\'; break;
+            case 'x':
+                if (i + 2 >= field->len || vector_hex(field->ptr[i + 1]) < 0
+                    || vector_hex(field->ptr[i + 2]) < 0)
+                    return VECTOR_BAD;
+                c = (char)(vector_hex(field->ptr[i + 1]) * 16 + vector_hex(field->ptr[i + 2]));
+                i += 2;
+                break;
+            default:
+                return VECTOR_BAD;
+            }
+        }
+        if (len + 1 >= cap)
+            return VECTOR_BAD;
+        out[len++] = c;
+    }
+    out[len] = '\0';
+    return len;
+}
+
+// Parse a signed decimal field; returns -1 if it is not a number
+static int vector_integer(const t_vector_field *field, long long *value) {
+    size_t i = 0;
+    int negative = 0;
+    long long result = 0;
+
+    if (i < field->len && (field->ptr[i] == '-' || field->ptr[i] == '+'))
+        negative = field->ptr[i++] == '-';
+    if (i == field->len)
+        return -1;
+    for (; i < field->len; i++) {
+        if (field->ptr[i] < '0' || field->ptr[i] > '9' || result > (LLONG_MAX - 9) / 10)
+            return -1;
+        result = result * 10 + (field->ptr[i] - '0');
+    }
+    *value = negative ? -result : result;
+    return 0;
+}
+
+// Unmap the file and fail the test with "<file>:<line>: <message>"
+static void vector_fail(t_vector_file *file, const char *fmt, ...) {
+    static char msg[256];
+    va_list args;
+    int len;
+
+    len = snprintf(msg, sizeof(msg), "%s:%zu: ", file->name, file->line);
+    va_start(args, fmt);
+    vsnprintf(msg + len, sizeof(msg) - (size_t)len, fmt, args);
+    va_end(args);
+    vector_close(file);
+    TEST_FAIL_MESSAGE(msg);
+}
+
+// Open a vector file or skip the test when it is not there
+#define VECTOR_OPEN(name, file) \
+    do { \
+        if (vector_open(name, file) != 0) \
+            TEST_IGNORE_MESSAGE("no test vectors: " name); \
+    } while (0)
+
+void test_atoi_vectors(void) {
+    t_vector_file file;
+    t_vector_field fields[VECTOR_MAX_FIELDS];
+    char input[VECTOR_FIELD_MAX];
+    long long expected;
+    int count;
+
+    VECTOR_OPEN("atoi.txt", &file);
+    while ((count = vector_next(&file, fields, VECTOR_MAX_FIELDS)) > 0) {
+        int result;
+
+        if (count != 2 || vector_string(&fields[0], input, sizeof(input)) == VECTOR_BAD
+            || vector_integer(&fields[1], &expected) != 0)
+            vector_fail(&file, "malformed record (want <input> <int>)");
+        result = ft_atoi(input);
+        if (result != (int)expected)
+            vector_fail(&file, "ft_atoi(\"%.40s\") = %d, expected %d", input, result, (int)expected);
+    }
+    vector_close(&file);
+}
+
+void test_itoa_vectors(void) {
+    t_vector_file file;
+    t_vector_field fields[VECTOR_MAX_FIELDS];
+    char expected[VECTOR_FIELD_MAX];
+    long long input;
+    int count;
+
+    VECTOR_OPEN("itoa.txt", &file);
+    while ((count = vector_next(&file, fields, VECTOR_MAX_FIELDS)) > 0) {
+        char *result;
+        int equal;
+
+        if (count != 2 || vector_integer(&fields[0], &input) != 0
+            || vector_string(&fields[1], expected, sizeof(expected)) == VECTOR_BAD)
+            vector_fail(&file, "malformed record (want <int> <string>)");
+        result = ft_itoa((int)input);
+        if (!result)
+            vector_fail(&file, "ft_itoa(%d) returned NULL", (int)input);
+        equal = strcmp(result, expected) == 0;
+        free(result);
+        if (!equal)
+            vector_fail(&file, "ft_itoa(%d) != \"%s\"", (int)input, expected);
+    }
+    vector_close(&file);
+}
+
+void test_strncmp_vectors(void) {
+    t_vector_file file;
+    t_vector_field fields[VECTOR_MAX_FIELDS];
+    char s1[VECTOR_FIELD_MAX];
+    char s2[VECTOR_FIELD_MAX];
+    long long n;
+    long long expected;
+    int count;
+
+    VECTOR_OPEN("strncmp.txt", &file);
+    while ((count = vector_next(&file, fields, VECTOR_MAX_FIELDS)) > 0) {
+        int result;
+
+        if (count != 4 || vector_string(&fields[0], s1, sizeof(s1)) == VECTOR_BAD
+            || vector_string(&fields[1], s2, sizeof(s2)) == VECTOR_BAD
+            || vector_integer(&fields[2], &n) != 0 || n < 0
+            || vector_integer(&fields[3], &expected) != 0)
+            vector_fail(&file, "malformed record (want <s1> <s2> <n> <sign>)");
+        result = ft_strncmp(s1, s2, (size_t)n);
+        if ((result > 0) - (result < 0) != (expected > 0) - (expected < 0))
+            vector_fail(&file, "ft_strncmp(\"%.30s\", \"%.30s\", %lld) = %d, expected sign %lld",
+                        s1, s2, n, result, expected);
+    }
+    vector_close(&file);
+}
+
+void test_strnstr_vectors(void) {
+    t_vector_file file;
+    t_vector_field fields[VECTOR_MAX_FIELDS];
+    char haystack[VECTOR_FIELD_MAX];
+    char needle[VECTOR_FIELD_MAX];
+    long long len;
+    long long expected;
+    int count;
+
+    VECTOR_OPEN("strnstr.txt", &file);
+    while ((count = vector_next(&file, fields, VECTOR_MAX_FIELDS)) > 0) {
+        char *result;
+        long long offset;
+
+        if (count != 4 || vector_string(&fields[0], haystack, sizeof(haystack)) == VECTOR_BAD
+            || vector_string(&fields[1], needle, sizeof(needle)) == VECTOR_BAD
+            || vector_integer(&fields[2], &len) != 0 || len < 0
+            || vector_integer(&fields[3], &expected) != 0)
+            vector_fail(&file, "malformed record (want <haystack> <needle> <len> <offset|-1>)");
+        result = ft_strnstr(haystack, needle, (size_t)len);
+        offset = result ? (long long)(result - haystack) : -1;
+        if (offset != expected)
+            vector_fail(&file, "ft_strnstr(\"%.30s\", \"%.30s\", %lld) at %lld, expected %lld",
+                        haystack, needle, len, offset, expected);
+    }
+    vector_close(&file);
+}
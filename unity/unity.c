@@ -546,6 +546,14 @@ void UnityConcludeTest(void)
     }
     else if (!Unity.CurrentTestFailed)
     {
+#ifdef UNITY_OUTPUT_QUIET_PASS
+        /* Quiet mode: passing tests produce no output at all */
+        if (UNITY_OUTPUT_QUIET_PASS)
+        {
+            UNITY_FLUSH_CALL();
+            return;
+        }
+#endif
         UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
         UnityPrint(UnityStrPass);
     }
@@ -0,0 +1,17 @@
+#ifndef UNITY_CONFIG_H
+# define UNITY_CONFIG_H
+
+/*
+** Unity output backend, implemented in test_main.c.
+** Characters go into the fully buffered stdout without taking the stream
+** lock, and the buffer is written out once per test when Unity concludes it.
+*/
+void	unity_output_char(int c);
+void	unity_output_flush(void);
+int		unity_output_quiet(void);
+
+# define UNITY_OUTPUT_CHAR(a) unity_output_char(a)
+# define UNITY_OUTPUT_FLUSH() unity_output_flush()
+# define UNITY_OUTPUT_QUIET_PASS unity_output_quiet()
+
+#endif
@@ -0,0 +1,133 @@
+#!/bin/bash
+
+# Rebuild libft and rerun only the tests and benchmarks affected by a change.
+# Usage: ./watch.sh <libft_dir> <test_binary> (normally through `make watch`)
+#
+# A changed ft_*.c marks every ft_ symbol its archive member defines, then
+# every member that references a marked symbol (nm "U" entries) is marked
+# too, until nothing changes: editing ft_strlen.c reruns ft_strjoin,
+# ft_strdup and every other caller. A changed header reruns everything.
+
+LIBFT_DIR="${1:-../Libft}"
+TEST_BIN="${2:-test_libft_bonus}"
+ARCHIVE="$LIBFT_DIR/libft.a"
+MAKE="${MAKE:-make}"
+POLL_INTERVAL="${WATCH_POLL_INTERVAL:-1}"
+
+STAMP="$(mktemp)"
+trap 'rm -f "$STAMP"' EXIT
+trap 'exit 0' INT TERM
+
+# Print the ft_ symbols defined by the given archive members and, transitively,
+# by every member that calls one of them
+affected_symbols() {
+    nm "$ARCHIVE" 2>/dev/null | awk -v changed="$*" '
+        BEGIN {
+            n = split(changed, list, " ")
+            for (i = 1; i <= n; i++)
+                dirty[list[i]] = 1
+        }
+        # GNU nm prints "member.o:", macOS nm prints "libft.a(member.o):"
+        /:$/ {
+            member = $0
+            sub(/:$/, "", member)
+            sub(/^.*\(/, "", member)
+            sub(/\)$/, "", member)
+            next
+        }
+        NF >= 2 {
+            type = $(NF - 1)
+            symbol = $NF
+            sub(/^_/, "", symbol)
+            if (symbol !~ /^ft_/)
+                next
+            if (type == "T")
+                defs[member] = defs[member] " " symbol
+            else if (type == "U")
+                uses[member] = uses[member] " " symbol
+        }
+        END {
+            for (m in dirty) {
+                k = split(defs[m], d, " ")
+                for (i = 1; i <= k; i++)
+                    hit[d[i]] = 1
+            }
+            do {
+                grew = 0
+                for (m in uses) {
+                    if (m in done)
+                        continue
+                    k = split(uses[m], u, " ")
+                    for (i = 1; i <= k; i++)
+                        if (u[i] in hit)
+                            break
+                    if (i > k)
+                        continue
+                    done[m] = 1
+                    k = split(defs[m], d, " ")
+                    for (i = 1; i <= k; i++)
+                        if (!(d[i] in hit)) {
+                            hit[d[i]] = 1
+                            grew = 1
+                        }
+                }
+            } while (grew)
+            for (s in hit)
+                printf "%s ", s
+        }'
+}
+
+# Block until something in LIBFT_DIR is written: inotify when inotifywait is
+# installed (inotify-tools), otherwise poll modification times
+wait_for_change() {
+    if command -v inotifywait >/dev/null 2>&1; then
+        inotifywait -q -e close_write -e moved_to -e create "$LIBFT_DIR" >/dev/null
+    else
+        while [ -z "$(find "$LIBFT_DIR" -maxdepth 1 \( -name 'ft_*.c' -o -name '*.h' \) -newer "$STAMP" | head -n 1)" ]; do
+            sleep "$POLL_INTERVAL"
+        done
+    fi
+}
+
+if ! command -v inotifywait >/dev/null 2>&1; then
+    echo "inotifywait not found; polling $LIBFT_DIR every ${POLL_INTERVAL}s"
+fi
+echo "Watching $LIBFT_DIR (Ctrl-C to stop)"
+
+while true; do
+    wait_for_change
+    # Let editors finish writing before collecting the batch of changes
+    sleep 0.2
+    sources="$(find "$LIBFT_DIR" -maxdepth 1 -name 'ft_*.c' -newer "$STAMP")"
+    headers="$(find "$LIBFT_DIR" -maxdepth 1 -name '*.h' -newer "$STAMP")"
+    # Our own builds write into LIBFT_DIR too; ignore those wakeups
+    if [ -z "$sources" ] && [ -z "$headers" ]; then
+        continue
+    fi
+    touch "$STAMP"
+
+    echo
+    echo "Changed: $(echo $sources $headers | xargs -n 1 basename | tr '\n' ' ')"
+    if ! "$MAKE" --no-print-directory -C "$LIBFT_DIR" bonus >/dev/null; then
+        echo "libft build failed"
+        continue
+    fi
+    if ! "$MAKE" --no-print-directory "$TEST_BIN" >/dev/null; then
+        echo "$TEST_BIN build failed"
+        continue
+    fi
+
+    if [ -n "$headers" ]; then
+        echo "Header changed; rerunning everything"
+        ./"$TEST_BIN" | sed 's/^/  /'
+        continue
+    fi
+    members="$(for src in $sources; do basename "${src%.c}.o"; done)"
+    symbols="$(affected_symbols $members)"
+    if [ -z "$symbols" ]; then
+        echo "No ft_ symbols defined in the changed files"
+        continue
+    fi
+    echo "Rerunning jobs for: $symbols"
+    TEST_SYMBOLS="$symbols" ./"$TEST_BIN" | sed 's/^/  /'
+done